@@ -0,0 +1,122 @@
+#ifndef LIBMESH_BENCHMARK_H
+#define LIBMESH_BENCHMARK_H
+
+// The harness for the libMesh micro-benchmark suite.  Each benchmark
+// translation unit defines one or more free functions and registers
+// them with a file-scope Benchmark::Register object; the driver runs
+// every registered function.  Benchmarks report timings through
+// Benchmark::report(), which emits one machine-readable CSV line per
+// timed case:
+//
+//   benchmark,case,iterations,seconds,ns_per_iter
+//
+// so per-commit results can be diffed, plotted, or loaded into a
+// spreadsheet.  Wall-clock noise is the user's problem: run on a
+// quiet machine and with an --enable-optimized build.
+
+// libMesh includes
+#include <libmesh/libmesh_common.h>
+
+// Forward declarations
+namespace libMesh
+{
+namespace Parallel
+{
+class Communicator;
+}
+}
+
+/**
+ * The communicator the driver was initialized with, for benchmarks
+ * which need to build meshes or systems.
+ */
+extern libMesh::Parallel::Communicator * BenchCommWorld;
+
+// C++ includes
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+namespace Benchmark
+{
+
+/**
+ * A simple steady-clock stopwatch.
+ */
+class Timer
+{
+public:
+  Timer () : _start(clock_type::now()) {}
+
+  /**
+   * Restarts the stopwatch.
+   */
+  void restart () { _start = clock_type::now(); }
+
+  /**
+   * \returns Seconds elapsed since construction or restart().
+   */
+  double seconds () const
+  {
+    return std::chrono::duration<double>
+      (clock_type::now() - _start).count();
+  }
+
+private:
+  typedef std::chrono::steady_clock clock_type;
+
+  clock_type::time_point _start;
+};
+
+
+/**
+ * \returns The global list of registered benchmark functions.
+ */
+inline std::vector<std::pair<std::string, void (*)()>> & registry ()
+{
+  static std::vector<std::pair<std::string, void (*)()>> benchmarks;
+  return benchmarks;
+}
+
+
+/**
+ * Registers a benchmark function at static initialization time.
+ */
+struct Register
+{
+  Register (const std::string & name, void (*fn)())
+  {
+    registry().emplace_back(name, fn);
+  }
+};
+
+
+/**
+ * Prints the CSV line for one timed case.
+ */
+void report (const std::string & benchmark,
+             const std::string & case_name,
+             std::size_t iterations,
+             double seconds);
+
+
+/**
+ * Accumulates a result the optimizer must not discard.  Call this
+ * with some value computed from each timed loop iteration's output.
+ */
+inline void keep (Real value)
+{
+  static volatile Real sink = 0;
+  sink = sink + value;
+}
+
+} // namespace Benchmark
+
+} // namespace libMesh
+
+#endif // LIBMESH_BENCHMARK_H
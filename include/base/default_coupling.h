@@ -24,6 +24,9 @@
 #include "libmesh/ghosting_functor.h"
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
 
+// C++ Includes
+#include <map>
+
 namespace libMesh
 {
 
@@ -60,6 +63,7 @@ public:
   DefaultCoupling(const DefaultCoupling & other) :
     GhostingFunctor(other),
     _dof_coupling(other._dof_coupling),
+    _subdomain_coupling(other._subdomain_coupling),
 #ifdef LIBMESH_ENABLE_PERIODIC
     _periodic_bcs(other._periodic_bcs),
 #endif
@@ -76,6 +80,27 @@ public:
   // Change coupling matrix after construction
   void set_dof_coupling(const CouplingMatrix * dof_coupling);
 
+  /**
+   * Use \p coupling as the variable coupling mask for elements in
+   * subdomain \p sid, overriding any mesh-wide coupling matrix set
+   * via set_dof_coupling().  This lets weakly-coupled multiphysics
+   * problems shrink sparsity allocation in subdomains where most
+   * variable pairs are uncoupled.  Passing nullptr removes the mask
+   * for \p sid, restoring the mesh-wide coupling there.
+   *
+   * The mask applied to each matrix block is that of the element
+   * providing the block's columns.
+   */
+  void set_subdomain_coupling(subdomain_id_type sid,
+                              const CouplingMatrix * coupling);
+
+  /**
+   * \returns The coupling matrix in effect for \p elem: the mask
+   * registered for its subdomain if any, otherwise the mesh-wide
+   * coupling matrix (which may be nullptr, meaning full coupling).
+   */
+  const CouplingMatrix * coupling_matrix(const Elem & elem) const;
+
   // Return number of levels of neighbors we will couple.
   unsigned int n_levels()
   { return _n_levels; }
@@ -120,6 +145,7 @@ public:
 private:
 
   const CouplingMatrix * _dof_coupling;
+  std::map<subdomain_id_type, const CouplingMatrix *> _subdomain_coupling;
 #ifdef LIBMESH_ENABLE_PERIODIC
   const PeriodicBoundaries * _periodic_bcs;
 #endif
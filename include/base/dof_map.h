@@ -25,6 +25,7 @@
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/variable.h"
+#include "libmesh/dense_matrix.h"
 #include "libmesh/threads.h"
 #include "libmesh/threads_allocators.h"
 #include "libmesh/elem_range.h"
@@ -37,9 +38,11 @@
 namespace libMesh
 {
 enum Order : int;
+enum DofLayoutType : int;
 }
 #else
 #include "libmesh/enum_order.h"
+#include "libmesh/enum_dof_layout_type.h"
 #endif
 
 // C++ Includes
@@ -242,6 +245,37 @@ public:
    */
   std::size_t distribute_dofs (MeshBase &);
 
+  /**
+   * Sets the ordering \p distribute_dofs() will use for the local
+   * degrees of freedom; see \p DofLayoutType for the choices.  Takes
+   * effect at the next call to \p distribute_dofs().  The
+   * --node-major-dofs commandline option still forces node-major
+   * numbering for all systems.
+   */
+  void set_dof_layout (const DofLayoutType layout);
+
+  /**
+   * \returns The ordering \p distribute_dofs() will use for the
+   * local degrees of freedom.
+   */
+  DofLayoutType dof_layout () const { return _dof_layout; }
+
+  /**
+   * Builds the permutation taking the current dof numbering to the
+   * numbering \p distribute_dofs() would have produced under \p
+   * layout: on exit \p permutation[i] holds the dof id which local
+   * dof \p first_dof()+i receives in the target layout.  Every
+   * layout numbers the locally owned dofs within the same range, so
+   * the permutation moves no dof between processors and costs one
+   * sweep over the local mesh.  Feed the result to
+   * \p LinearSolver::solve_in_permuted_order() to assemble in a
+   * cache-friendly ordering and solve in a preconditioner-friendly
+   * one without hand-built scatters.
+   */
+  void local_layout_permutation (const MeshBase & mesh,
+                                 const DofLayoutType layout,
+                                 std::vector<dof_id_type> & permutation) const;
+
   /**
    * Computes the sparsity pattern for the matrices corresponding to
    * \p proc_id and sends that data to Linear Algebra packages for
@@ -273,6 +307,26 @@ public:
    */
   bool constrained_sparsity_construction();
 
+  /**
+   * Sets the current policy for reusing sparsity patterns across
+   * redistributions: if \p reuse is true, \p distribute_dofs()
+   * fingerprints the dof distribution it produces, and a subsequent
+   * \p compute_sparsity() keeps the previously computed pattern
+   * whenever that fingerprint is unchanged on every processor - e.g.
+   * after an adaptive step which ended up refining and coarsening
+   * nothing.  This is false by default, because user code can change
+   * the required pattern without changing the distribution, e.g. via
+   * constraint or sparsity augmentation changes.
+   */
+  void set_reuse_unchanged_sparsity(bool reuse);
+
+  /**
+   * Returns true iff the current policy is to let compute_sparsity()
+   * reuse its previous pattern when the dof distribution is provably
+   * unchanged.
+   */
+  bool reuse_unchanged_sparsity() const;
+
   /**
    * Clears the sparsity pattern
    */
@@ -755,6 +809,29 @@ public:
                     const unsigned int vn,
                     int p_level = -12345) const;
 
+  /**
+   * Fills the flat buffer \p di with the global degree of freedom
+   * indices for every element in \p range, in iteration order, along
+   * with CSR-style offsets into it: element \p e of the range owns
+   * the indices in [di[elem_offsets[e]], di[elem_offsets[e+1]]).
+   * Both vectors are resized as needed but their capacity is reused
+   * across calls, so assembly loops which process elements in ranges
+   * avoid the per-element allocations of the single-element overload.
+   */
+  void dof_indices (const ConstElemRange & range,
+                    std::vector<dof_id_type> & di,
+                    std::vector<std::size_t> & elem_offsets) const;
+
+  /**
+   * Fills the flat buffer \p di with the global degree of freedom
+   * indices of variable \p vn for every element in \p range, with
+   * CSR-style offsets as in the all-variables overload above.
+   */
+  void dof_indices (const ConstElemRange & range,
+                    std::vector<dof_id_type> & di,
+                    std::vector<std::size_t> & elem_offsets,
+                    const unsigned int vn) const;
+
   /**
    * Fills the vector \p di with the global degree of freedom indices
    * for the \p node.
@@ -949,6 +1026,43 @@ public:
    */
   void process_constraints (MeshBase &);
 
+  /**
+   * Enable or disable caching of the constraint matrix expansions
+   * built by build_constraint_matrix().  The expansion of a given
+   * element dof list only changes when the constraints themselves
+   * change (e.g. at AMR steps), so with caching enabled each distinct
+   * dof list has its constraint matrix built once per constraint
+   * recalculation and constrained assembly reduces to a cached dense
+   * matrix-matrix multiply.  The cache is cleared automatically
+   * whenever the raw constraints are modified.  Caching is disabled
+   * by default since the cache can require substantial memory for
+   * large per-processor meshes.
+   */
+  void set_constraint_matrix_caching (bool enabled);
+
+  bool get_constraint_matrix_caching () const
+  { return _constraint_matrix_caching; }
+
+  /**
+   * Flattens the current constraint rows into contiguous CSR-style
+   * arrays.  After process_constraints() every row references only
+   * unconstrained dofs, so build_constraint_matrix() can then expand
+   * an element dof list in a single sweep over the compiled arrays
+   * instead of chasing DofConstraints map lookups recursively.  This
+   * is called automatically at the end of process_constraints(); the
+   * compiled form is discarded whenever the raw constraints are
+   * modified afterwards, at which point the map-based fallback takes
+   * over again.
+   */
+  void compile_constraints ();
+
+  /**
+   * \returns \p true if a compiled (flattened) form of the current
+   * constraints is available.
+   */
+  bool constraints_compiled () const
+  { return !_flat_constraint_offsets.empty(); }
+
   /**
    * Throw an error if we detect any constraint loops, i.e.
    * A -> B -> C -> A
@@ -1017,12 +1131,16 @@ public:
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _constraint_matrix_cache.clear();
+    this->clear_compiled_constraints();
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _constraint_matrix_cache.clear();
+    this->clear_compiled_constraints();
   }
 
   /**
@@ -1040,6 +1158,8 @@ public:
   void swap_dof_constraints()
   {
     _dof_constraints.swap(_stashed_dof_constraints);
+    _constraint_matrix_cache.clear();
+    this->clear_compiled_constraints();
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1160,6 +1280,17 @@ public:
                                  std::vector<dof_id_type> & dofs,
                                  bool asymmetric_constraint_rows = true) const;
 
+  /**
+   * Constrains multiple element vectors which share the same \p dofs,
+   * e.g. the derivatives of several quantities of interest on one
+   * element.  The constraint matrix is built once and applied to
+   * every vector, so constraining \p n vectors together costs little
+   * more than constraining one.
+   */
+  void constrain_element_vectors (std::vector<DenseVector<Number> *> & rhs_vectors,
+                                  std::vector<dof_id_type> & dofs,
+                                  bool asymmetric_constraint_rows = true) const;
+
   /**
    * Constrains the element matrix and vector.  This method requires
    * the element matrix to be square, in which case the elem_dofs
@@ -1457,6 +1588,14 @@ public:
    */
   std::string get_info() const;
 
+  /**
+   * \returns An estimate, in bytes, of the memory occupied on this
+   * processor by the dof indexing arrays, the sparsity pattern, and
+   * the constraint rows.  This is intended for instrumentation at
+   * phase boundaries, not for exact accounting.
+   */
+  std::size_t memory_footprint () const;
+
   /**
    * Degree of freedom coupling.  If left empty each DOF
    * couples to all others.  Can be used to reduce memory
@@ -1498,19 +1637,25 @@ private:
 
   /**
    * Helper function that gets the dof indices on the current element
-   * for a non-SCALAR type variable, where the variable is identified
-   * by its variable group number \p vg and its offset \p vig from the
-   * first variable in that group.
+   * for a non-SCALAR type variable group, for the variables with
+   * offsets [\p vig_begin, \p vig_end) from the first variable in
+   * group \p vg, appending each variable's indices in turn.
+   *
+   * Since a DofObject stores just one base index per variable group,
+   * the per-node storage lookups are done once for the whole group
+   * and every variable's indices are then computed from them
+   * arithmetically.
    *
    * In DEBUG mode, the tot_size parameter will add up the total
    * number of dof indices that should have been added to di, and v
-   * will be the variable number corresponding to vg and vig.
+   * will be the variable number corresponding to vg and vig_begin.
    */
   void _dof_indices (const Elem & elem,
                      int p_level,
                      std::vector<dof_id_type> & di,
                      const unsigned int vg,
-                     const unsigned int vig,
+                     const unsigned int vig_begin,
+                     const unsigned int vig_end,
                      const Node * const * nodes,
                      unsigned int       n_nodes
 #ifdef DEBUG
@@ -1585,6 +1730,16 @@ private:
   void distribute_local_dofs_node_major (dof_id_type & next_free_dof,
                                          MeshBase & mesh);
 
+  /**
+   * \returns A fingerprint of the current dof distribution: a hash of
+   * the connectivity of our local elements together with the dof
+   * numbering of every object attached to them.  Two distributions
+   * with equal fingerprints on every processor give rise to the same
+   * sparsity pattern.  Never returns zero, which is reserved to mean
+   * "no fingerprint computed".
+   */
+  std::size_t compute_distribution_hash (const MeshBase & mesh) const;
+
   /*
    * A utility method for obtaining a set of elements to ghost along
    * with merged coupling matrices.
@@ -1620,6 +1775,17 @@ private:
                                 std::vector<dof_id_type> & elem_dofs,
                                 const bool called_recursively=false) const;
 
+  /**
+   * Scans \p elem_dofs for constrained dofs.  \returns \p true if
+   * every constrained dof found has an empty constraint row - a pure
+   * elimination constraint, such as a Dirichlet boundary dof - in
+   * which case \p eliminated_dofs holds their positions within \p
+   * elem_dofs.  Such elements can be constrained by masking rows and
+   * columns in place, skipping the full C^T K C expansion.
+   */
+  bool elimination_constraints_only (const std::vector<dof_id_type> & elem_dofs,
+                                     std::vector<unsigned int> & eliminated_dofs) const;
+
   /**
    * Build the constraint matrix C and the forcing vector H
    * associated with the element degree of freedom indices elem_dofs.
@@ -1682,6 +1848,20 @@ private:
    */
   bool _constrained_sparsity_construction;
 
+  /**
+   * This flag indicates whether compute_sparsity() may keep its
+   * previous pattern when the dof distribution is provably unchanged.
+   */
+  bool _reuse_unchanged_sparsity;
+
+  /**
+   * Fingerprints of the current dof distribution and of the
+   * distribution the current sparsity pattern was computed from.
+   * Zero means "not yet computed".
+   */
+  std::size_t _distribution_hash;
+  std::size_t _sp_distribution_hash;
+
   /**
    * The finite element type for each variable.
    */
@@ -1872,6 +2052,50 @@ private:
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
+
+  /**
+   * Whether to cache constraint matrix expansions; see
+   * set_constraint_matrix_caching().
+   */
+  bool _constraint_matrix_caching;
+
+  /**
+   * Cache of constraint matrix expansions, keyed on the original
+   * (unexpanded) element dof list.  Each entry stores the constraint
+   * matrix together with the expanded dof list; an entry with an
+   * empty matrix records that the dof list has no constraints.
+   * Mutable since the cache is filled lazily from the const
+   * build_constraint_matrix().
+   */
+  mutable std::map<std::vector<dof_id_type>,
+                   std::pair<DenseMatrix<Number>, std::vector<dof_id_type>>>
+  _constraint_matrix_cache;
+
+  /**
+   * Compiled ("flattened") constraint storage, built by
+   * compile_constraints(): the sorted constrained dof ids, CSR row
+   * offsets into the column/coefficient arrays, and the primal
+   * right-hand side of each row.  Empty when no compiled form is
+   * available.
+   */
+  std::vector<dof_id_type> _flat_constraint_dofs;
+  std::vector<std::size_t> _flat_constraint_offsets;
+  std::vector<dof_id_type> _flat_constraint_cols;
+  std::vector<Number>      _flat_constraint_vals;
+  std::vector<Number>      _flat_constraint_rhs;
+
+  /**
+   * Discards any compiled constraint storage; called whenever the
+   * raw constraints change.
+   */
+  void clear_compiled_constraints ()
+  {
+    _flat_constraint_dofs.clear();
+    _flat_constraint_offsets.clear();
+    _flat_constraint_cols.clear();
+    _flat_constraint_vals.clear();
+    _flat_constraint_rhs.clear();
+  }
 #endif
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -1912,6 +2136,12 @@ private:
    */
   bool _implicit_neighbor_dofs_initialized;
   bool _implicit_neighbor_dofs;
+
+  /**
+   * The ordering used for the local degrees of freedom; see
+   * set_dof_layout().
+   */
+  DofLayoutType _dof_layout;
 };
 
 
@@ -2076,6 +2306,10 @@ inline void DofMap::constrain_element_vector (DenseVector<Number> &,
                                               std::vector<dof_id_type> &,
                                               bool) const {}
 
+inline void DofMap::constrain_element_vectors (std::vector<DenseVector<Number> *> &,
+                                               std::vector<dof_id_type> &,
+                                               bool) const {}
+
 inline void DofMap::constrain_element_matrix_and_vector (DenseMatrix<Number> &,
                                                          DenseVector<Number> &,
                                                          std::vector<dof_id_type> &,
@@ -2139,6 +2373,22 @@ bool DofMap::constrained_sparsity_construction()
 #endif
 }
 
+
+
+inline
+void DofMap::set_reuse_unchanged_sparsity(bool reuse)
+{
+  _reuse_unchanged_sparsity = reuse;
+}
+
+
+
+inline
+bool DofMap::reuse_unchanged_sparsity() const
+{
+  return _reuse_unchanged_sparsity;
+}
+
 } // namespace libMesh
 
 #endif // LIBMESH_DOF_MAP_H
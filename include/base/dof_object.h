@@ -75,10 +75,16 @@ public:
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
-   * This object on the last mesh.  Useful for projecting
-   * solutions from one mesh to another.
+   * \returns This object on the last mesh, or \p nullptr if no old
+   * indexing has been stored.  Useful for projecting solutions from
+   * one mesh to another.
+   *
+   * In compact-header builds the old object lives in a side table
+   * rather than in a pointer carried by every \p DofObject, so this
+   * accessor is the only way to reach it.
    */
-  DofObject * old_dof_object;
+  DofObject * get_old_dof_object ();
+  const DofObject * get_old_dof_object () const;
 
   /**
    * Sets the \p old_dof_object to nullptr
@@ -521,6 +527,17 @@ private:
                                      const unsigned int vg,
                                      const unsigned int var) const;
 
+  /**
+   * This object on the last mesh.  In compact-header builds this
+   * pointer is omitted and the old object, which only exists between
+   * mesh changes and the subsequent projection, is kept in a side
+   * table instead, saving \p sizeof(DofObject*) on every node and
+   * element.
+   */
+#if defined(LIBMESH_ENABLE_AMR) && !defined(LIBMESH_ENABLE_COMPACT_DOF_OBJECTS)
+  DofObject * old_dof_object;
+#endif
+
   /**
    * A globally unique id, guaranteed not to change as the mesh is repartitioned or adapted
    */
@@ -676,7 +693,7 @@ public:
 // Inline functions
 inline
 DofObject::DofObject () :
-#ifdef LIBMESH_ENABLE_AMR
+#if defined(LIBMESH_ENABLE_AMR) && !defined(LIBMESH_ENABLE_COMPACT_DOF_OBJECTS)
   old_dof_object(nullptr),
 #endif
 #ifdef LIBMESH_ENABLE_UNIQUE_ID
@@ -704,6 +721,28 @@ DofObject::~DofObject ()
 
 
 
+#ifdef LIBMESH_ENABLE_AMR
+#ifndef LIBMESH_ENABLE_COMPACT_DOF_OBJECTS
+
+inline
+DofObject * DofObject::get_old_dof_object ()
+{
+  return old_dof_object;
+}
+
+
+
+inline
+const DofObject * DofObject::get_old_dof_object () const
+{
+  return old_dof_object;
+}
+
+#endif // !LIBMESH_ENABLE_COMPACT_DOF_OBJECTS
+#endif // LIBMESH_ENABLE_AMR
+
+
+
 inline
 void DofObject::invalidate_dofs (const unsigned int sys_num)
 {
@@ -28,6 +28,8 @@
 #include "libmesh/auto_ptr.h" // libmesh_make_unique
 
 // C++ Includes
+#include <cstddef>
+#include <iterator>
 #include <unordered_map>
 
 namespace libMesh
@@ -160,19 +162,41 @@ public:
   /**
    * Constructor.  Empty in the base class.
    */
-  GhostingFunctor(): _mesh(nullptr) {}
+  GhostingFunctor():
+    _mesh(nullptr),
+    _query_cache_enabled(false),
+    _query_cache_valid(false),
+    _cached_generation(0),
+    _cached_p(0),
+    _cached_range_first(nullptr),
+    _cached_range_size(0)
+  {}
 
   /**
    * Constructor using mesh
    */
-  GhostingFunctor(const MeshBase & mesh): _mesh(&mesh) {}
+  GhostingFunctor(const MeshBase & mesh):
+    _mesh(&mesh),
+    _query_cache_enabled(false),
+    _query_cache_valid(false),
+    _cached_generation(0),
+    _cached_p(0),
+    _cached_range_first(nullptr),
+    _cached_range_size(0)
+  {}
 
   /**
-   * Copy Constructor
+   * Copy Constructor.  We do not copy any cached query results.
    */
   GhostingFunctor(const GhostingFunctor & other) :
    ReferenceCountedObject<GhostingFunctor>(other),
-   _mesh (other._mesh)
+   _mesh (other._mesh),
+   _query_cache_enabled(other._query_cache_enabled),
+   _query_cache_valid(false),
+   _cached_generation(0),
+   _cached_p(0),
+   _cached_range_first(nullptr),
+   _cached_range_size(0)
   {}
 
   /**
@@ -227,13 +251,41 @@ public:
                            processor_id_type p,
                            map_type & coupled_elements) = 0;
 
+  /**
+   * Enables or disables generation-stamped caching of \p operator()
+   * results.  When enabled, a repeated query over the same element
+   * range with the same processor id on an unchanged mesh - as judged
+   * by \p MeshBase::generation() - is answered from the cache instead
+   * of re-walking element neighborhoods, which saves most of the
+   * ghosting evaluation cost when reinits and sparsity rebuilds query
+   * the same functor repeatedly between mesh changes.  Off by
+   * default; honored by the library's built-in functors, and by any
+   * subclass whose \p operator() calls \p query_cache_lookup() and \p
+   * query_cache_store().
+   */
+  void enable_query_cache (bool enable = true)
+  {
+    _query_cache_enabled = enable;
+    if (!enable)
+      this->clear_query_cache();
+  }
+
+  /**
+   * Discards any cached \p operator() results.
+   */
+  void clear_query_cache ()
+  {
+    _query_cache_valid = false;
+    _query_cache.clear();
+  }
+
   /**
    * GhostingFunctor subclasses which cache data will need to
    * initialize that cache.  We call mesh_reinit() whenever the
    * relevant Mesh has changed, but before remote elements on a
    * distributed mesh are deleted.
    */
-  virtual void mesh_reinit () {};
+  virtual void mesh_reinit () { this->clear_query_cache(); };
 
   /**
    * For algebraic ghosting or coupling functors we also call
@@ -253,17 +305,94 @@ public:
    * elements have not yet been deleted by the processors which
    * previously held them..
    */
-  virtual void redistribute () {};
+  virtual void redistribute () { this->clear_query_cache(); };
 
   /**
    * GhostingFunctor subclasses with relatively long-lasting caches
    * may want to delete the no-longer-relevant parts of those caches
    * after a redistribution is complete.
    */
-  virtual void delete_remote_elements () {};
+  virtual void delete_remote_elements () { this->clear_query_cache(); };
 
 protected:
+
+  /**
+   * If the query cache is enabled and holds the result of a query
+   * matching this one - same mesh generation, processor id, and
+   * element range - copies the cached result into \p coupled_elements
+   * and returns \p true.  Subclasses should call this at the top of
+   * \p operator() and return immediately on a hit.
+   */
+  bool query_cache_lookup (const MeshBase::const_element_iterator & range_begin,
+                           const MeshBase::const_element_iterator & range_end,
+                           processor_id_type p,
+                           map_type & coupled_elements) const
+  {
+    if (!_query_cache_enabled || !_query_cache_valid || !_mesh)
+      return false;
+
+    if (_cached_generation != _mesh->generation() ||
+        _cached_p != p ||
+        _cached_range_first != ((range_begin == range_end) ?
+                                nullptr : *range_begin) ||
+        _cached_range_size !=
+          static_cast<std::size_t>(std::distance(range_begin, range_end)))
+      return false;
+
+    coupled_elements.insert(_query_cache.begin(), _query_cache.end());
+    return true;
+  }
+
+  /**
+   * If the query cache is enabled, records \p coupled_elements as the
+   * result of the described query.  Subclasses should call this at
+   * the bottom of \p operator(), which is handed an empty map by the
+   * library's merging code.
+   */
+  void query_cache_store (const MeshBase::const_element_iterator & range_begin,
+                          const MeshBase::const_element_iterator & range_end,
+                          processor_id_type p,
+                          const map_type & coupled_elements)
+  {
+    if (!_query_cache_enabled || !_mesh)
+      return;
+
+    _cached_generation = _mesh->generation();
+    _cached_p = p;
+    _cached_range_first = (range_begin == range_end) ?
+      nullptr : *range_begin;
+    _cached_range_size =
+      static_cast<std::size_t>(std::distance(range_begin, range_end));
+    _query_cache = coupled_elements;
+    _query_cache_valid = true;
+  }
+
   const MeshBase * _mesh;
+
+  /**
+   * If true, \p operator() results may be served from \p _query_cache.
+   */
+  bool _query_cache_enabled;
+
+  /**
+   * True if \p _query_cache holds the result of a previous query.
+   */
+  bool _query_cache_valid;
+
+  /**
+   * Fingerprint of the cached query: the mesh generation stamp when
+   * it ran, the processor id, and the queried element range's first
+   * element and length.
+   */
+  unsigned long _cached_generation;
+  processor_id_type _cached_p;
+  const Elem * _cached_range_first;
+  std::size_t _cached_range_size;
+
+  /**
+   * The cached result of the last query.
+   */
+  map_type _query_cache;
 };
 
 } // namespace libMesh
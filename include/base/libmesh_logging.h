@@ -91,6 +91,38 @@ private:
 
 
 
+/**
+ * The scoped counterpart of PerfLog's low-overhead interface: starts
+ * the pre-registered fast event \p event_id on construction and stops
+ * it on destruction.  Should not be used directly, instead use the
+ * FAST_LOG_SCOPE macro, which registers the event once per call site
+ * and resolves to nothing at compile time if logging is disabled.
+ *
+ * \author John Peterson
+ * \date 2020
+ */
+struct FastPerfItem
+{
+  FastPerfItem(const unsigned int event_id,
+               PerfLog * my_perflog=&perflog) :
+    _event_id(event_id),
+    _perflog(*my_perflog)
+  {
+    _perflog.fast_start(event_id);
+  }
+
+  ~FastPerfItem()
+  {
+    _perflog.fast_stop(_event_id);
+  }
+
+private:
+  unsigned int _event_id;
+  PerfLog & _perflog;
+};
+
+
+
 } // namespace libMesh
 
 
@@ -106,6 +138,8 @@ private:
 #  define LOG_SCOPE(a,b)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b);
 #  define LOG_SCOPE_IF(a,b,enabled)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,enabled);
 #  define LOG_SCOPE_WITH(a,b,logger)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,true,&logger);
+#  define FAST_LOG_SCOPE(a,b)   static const unsigned int TOKENPASTE2(fast_event_, __LINE__) = libMesh::perflog.register_event(a,b); \
+                                libMesh::FastPerfItem TOKENPASTE2(fast_perf_item_, __LINE__)(TOKENPASTE2(fast_event_, __LINE__));
 
 #else
 
@@ -116,6 +150,7 @@ private:
 #  define LOG_SCOPE(a,b)   {}
 #  define LOG_SCOPE_IF(a,b,enabled) {}
 #  define LOG_SCOPE_WITH(a,b,logger) {}
+#  define FAST_LOG_SCOPE(a,b) {}
 
 #endif
 
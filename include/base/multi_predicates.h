@@ -388,6 +388,25 @@ struct ActiveType : abstract_multi_predicate<T>
 
 
 
+/**
+ * Used to iterate over non-nullptr, active, local elements of a given
+ * geometric type.
+ */
+template <typename T>
+struct ActiveLocalType : abstract_multi_predicate<T>
+{
+  ActiveLocalType(processor_id_type my_pid,
+                  ElemType type)
+  {
+    this->_predicates.push_back(new not_null<T>);
+    this->_predicates.push_back(new active<T>);
+    this->_predicates.push_back(new pid<T>(my_pid));
+    this->_predicates.push_back(new elem_type<T>(type));
+  }
+};
+
+
+
 #ifdef LIBMESH_ENABLE_AMR
 /**
  * Used to iterate over non-nullptr, elements with a given refinement
@@ -29,12 +29,15 @@
 // C++ Includes
 #include <map>
 #include <memory>
+#include <tuple>
+#include <utility>
 
 namespace libMesh
 {
 
 // Forward Declarations
 class Elem;
+class MeshBase;
 class PeriodicBoundaryBase;
 class PointLocatorBase;
 
@@ -69,6 +72,36 @@ public:
                         const Elem * e,
                         unsigned int side,
                         unsigned int * neigh_side = nullptr) const;
+
+  /**
+   * Precomputes periodic neighbor pairings for every active element
+   * side on a periodic boundary, by gathering the face centroids on
+   * each paired boundary and matching them against the transformed
+   * centroids from the other side.  Afterwards neighbor() answers
+   * from the cache instead of querying a point locator.
+   *
+   * This is collective over \p mesh's communicator, and the cache is
+   * only valid until the mesh next changes; rebuild or call
+   * clear_neighbor_cache() after refinement or redistribution.
+   * Pairings the matching cannot establish (e.g. under a non-affine
+   * user transformation, where a face centroid doesn't map to its
+   * image's centroid) are simply left out of the cache, and those
+   * neighbor() queries fall back to the point locator.
+   */
+  void build_neighbor_cache(const MeshBase & mesh);
+
+  /**
+   * Discards the cache built by build_neighbor_cache().
+   */
+  void clear_neighbor_cache() { _neighbor_cache.clear(); }
+
+private:
+  /**
+   * Cached pairings: (boundary id, element id, side) to (periodic
+   * neighbor element id, neighbor side).
+   */
+  std::map<std::tuple<boundary_id_type, dof_id_type, unsigned int>,
+           std::pair<dof_id_type, unsigned int>> _neighbor_cache;
 };
 
 } // namespace libMesh
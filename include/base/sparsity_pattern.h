@@ -216,6 +216,14 @@ private:
   // unnecessary caluclations.
   std::unordered_set<dof_id_type> hashed_dof_sets;
 
+  // The local rows this object has actually added entries to, stored
+  // as offsets from the first DoF on this processor and kept sorted
+  // and unique by operator().  Each thread of a split Build only
+  // touches the rows connected to its own element range, so join()
+  // can merge and recount just the other thread's bucket of touched
+  // rows instead of walking every row on the processor.
+  std::vector<dof_id_type> touched_local_rows;
+
   void handle_vi_vj(const std::vector<dof_id_type> & element_dofs_i,
                     const std::vector<dof_id_type> & element_dofs_j);
 
@@ -0,0 +1,50 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ENUM_DOF_LAYOUT_TYPE_H
+#define LIBMESH_ENUM_DOF_LAYOUT_TYPE_H
+
+namespace libMesh {
+
+/**
+ * \enum DofLayoutType defines an \p enum for the orderings
+ * DofMap::distribute_dofs() can produce for the local degrees of
+ * freedom.
+ *
+ * The fixed type, i.e. ": int", enumeration syntax used here allows
+ * this enum to be forward declared as
+ * enum DofLayoutType : int;
+ * reducing header file dependencies.
+ */
+enum DofLayoutType : int {
+  // Number each variable group's dofs in a contiguous block.  Within
+  // a group the components at one node or element stay adjacent, so
+  // grouping variables of the same type gives a hybrid layout with
+  // interleaving inside the group blocks.  Block-structured
+  // preconditioners (e.g. AMG with known block sizes) want this.
+  DOF_LAYOUT_VAR_MAJOR = 0,
+  // Interleave: number all the dofs at one node or element before
+  // moving to the next.  Assembly touches contiguous memory per
+  // element with this layout.
+  DOF_LAYOUT_NODE_MAJOR
+};
+
+}
+
+#endif
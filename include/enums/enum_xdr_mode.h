@@ -26,6 +26,9 @@ namespace libMesh {
  * Defines an \p enum for read/write mode in Xdr format.
  * \p READ, \p WRITE perform reading and writing in ASCII format,
  * and \p DECODE, \p ENCODE do the same in binary format.
+ * \p READ_BINARY, \p WRITE_BINARY use a raw native-endian binary
+ * format whose bulk data blocks can be read directly out of a
+ * memory-mapped file, with no per-value decoding.
  *
  * The fixed type, i.e. ": int", enumeration syntax used here allows
  * this enum to be forward declared as
@@ -38,7 +41,9 @@ enum XdrMODE : int
     ENCODE=0,
     DECODE,
     WRITE,
-    READ
+    READ,
+    WRITE_BINARY,
+    READ_BINARY
   };
 }
 
@@ -143,6 +143,23 @@ public:
                                 const std::map<const System *, const NumericVector<Number> *> * solution_vectors = nullptr,
                                 bool estimate_parent_error = false);
 
+  /**
+   * Runs every estimator in \p estimators over \p system, filling
+   * errors_per_cell[i] from estimators[i].  Estimators which can
+   * share a single mesh traversal and one set of finite element
+   * reinits are run together rather than back to back: currently all
+   * the JumpErrorEstimator subclasses with matching quadrature rule
+   * settings form such a group, so e.g. a KellyErrorEstimator used
+   * for flagging and a DiscontinuityMeasure used for diagnostics cost
+   * one face sweep instead of two.  Estimators which cannot share a
+   * sweep just have their estimate_error() called individually.
+   */
+  static void estimate_errors (const System & system,
+                               const std::vector<ErrorEstimator *> & estimators,
+                               const std::vector<ErrorVector *> & errors_per_cell,
+                               const NumericVector<Number> * solution_vector = nullptr,
+                               bool estimate_parent_error = false);
+
   /**
    * \returns The type for the ErrorEstimator subclass.
    */
@@ -23,11 +23,14 @@
 // Local Includes
 #include "libmesh/error_estimator.h"
 #include "libmesh/function_base.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
 #include "libmesh/vector_value.h"
 #include "libmesh/tensor_value.h"
 
 // C++ includes
 #include <cstddef>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -38,9 +41,8 @@ namespace libMesh
 class Elem;
 template <typename T> class FEGenericBase;
 typedef FEGenericBase<Real> FEBase;
-class MeshFunction;
-class Point;
 class Parameters;
+class PointLocatorBase;
 template <typename T> class DenseVector;
 
 /**
@@ -155,6 +157,17 @@ public:
    */
   void attach_reference_solution (EquationSystems * es_fine);
 
+  /**
+   * Clears the interpolation data cached by \p estimate_error() when a
+   * reference solution is attached: for each coarse-mesh quadrature
+   * point, the containing fine-mesh element and the corresponding
+   * reference coordinates.  The cache stores pointers into the fine
+   * mesh, so it must be cleared whenever either mesh changes (e.g. is
+   * refined or coarsened) between estimates.  Attaching a new
+   * reference solution clears it automatically.
+   */
+  void clear_fine_interpolation_cache ();
+
 
   /**
    * Increases or decreases the order of the quadrature rule used for numerical
@@ -228,6 +241,29 @@ private:
    */
   EquationSystems * _equation_systems_fine;
 
+  /**
+   * Interpolation data cached for a single coarse-mesh quadrature
+   * point when estimating against a reference fine-grid solution: the
+   * physical point, the fine-mesh element containing it, and the
+   * corresponding reference coordinates on that element.
+   */
+  struct FinePointData
+  {
+    Point xyz;
+    const Elem * fine_elem = nullptr;
+    Point ref_point;
+  };
+
+  /**
+   * Cached fine-grid interpolation data, keyed by coarse element id
+   * and indexed by quadrature point.  Built lazily during
+   * \p estimate_error() and reused across variables and repeated
+   * estimates, so each physical point only pays for point location and
+   * inverse mapping once.  Mutable because it is filled in from the
+   * \p const element-wise helpers.
+   */
+  mutable std::map<dof_id_type, std::vector<FinePointData>> _fine_interpolation_cache;
+
   /**
    * Helper method for calculating on each element
    */
@@ -236,7 +272,24 @@ private:
                                    const Elem * elem,
                                    const DenseVector<Number> & Uelem,
                                    FEBase * fe,
-                                   MeshFunction * fine_values) const;
+                                   const NumericVector<Number> * fine_soln,
+                                   const PointLocatorBase * fine_locator) const;
+
+  /**
+   * Helper method which evaluates the reference fine-grid solution
+   * (values, gradients, and, if \p fine_grad2_u is non-null, second
+   * derivatives) at each point of \p q_point, using and updating the
+   * persistent interpolation cache.
+   */
+  void evaluate_fine_solution (const System & fine_system,
+                               const unsigned int fine_var,
+                               const Elem * coarse_elem,
+                               const std::vector<Point> & q_point,
+                               const NumericVector<Number> & fine_soln,
+                               const PointLocatorBase & fine_locator,
+                               std::vector<Number> & fine_u,
+                               std::vector<Gradient> & fine_grad_u,
+                               std::vector<Tensor> * fine_grad2_u) const;
 
   /**
    * Helper method for cleanup
@@ -88,6 +88,31 @@ public:
                                const NumericVector<Number> * solution_vector = nullptr,
                                bool estimate_parent_error = false) override;
 
+  /**
+   * Don't hide the inherited per-EquationSystems overloads behind the
+   * static one below.
+   */
+  using ErrorEstimator::estimate_errors;
+
+  /**
+   * Runs every jump estimator in \p estimators in a single mesh
+   * traversal with one set of FE reinits per face, filling
+   * errors_per_cell[i] from estimators[i].  Each estimator's
+   * init_context() pre-requests its FE data on a shared pair of
+   * contexts, so each face is reinitialized once for the union of the
+   * estimators' needs and every estimator's side integrations then
+   * read from the shared data.
+   *
+   * All the estimators must agree on
+   * use_unweighted_quadrature_rules; flux-face scaling and boundary
+   * integration settings are honored per estimator.
+   */
+  static void estimate_errors (const System & system,
+                               const std::vector<JumpErrorEstimator *> & estimators,
+                               const std::vector<ErrorVector *> & errors_per_cell,
+                               const NumericVector<Number> * solution_vector = nullptr,
+                               bool estimate_parent_error = false);
+
   /**
    * This boolean flag allows you to scale the error indicator
    * result for each element by the number of "flux faces" the element
@@ -22,10 +22,12 @@
 
 // Local Includes
 #include "libmesh/jump_error_estimator.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -33,6 +35,7 @@ namespace libMesh
 
 // Forward Declarations
 class Point;
+class Elem;
 
 /**
  * This class implements the Kelly error indicator
@@ -81,6 +84,21 @@ public:
   KellyErrorEstimator & operator= (KellyErrorEstimator &&) = default;
   virtual ~KellyErrorEstimator() = default;
 
+  /**
+   * This function uses the Kelly flux jump indicator to estimate the
+   * error on each cell.  It builds a deduplicated list of the faces
+   * to integrate -- each interior face appears once instead of being
+   * visited from both sides -- and integrates them in parallel, with
+   * per-thread FE objects and per-thread error accumulation.  Parent
+   * error estimates and flux face scaling are not supported by the
+   * threaded path and fall back to the general
+   * JumpErrorEstimator::estimate_error() implementation.
+   */
+  virtual void estimate_error (const System & system,
+                               ErrorVector & error_per_cell,
+                               const NumericVector<Number> * solution_vector = nullptr,
+                               bool estimate_parent_error = false) override;
+
   /**
    * Register a user function to use in computing the flux BCs.
    */
@@ -119,6 +137,39 @@ protected:
   std::pair<bool,Real> (* _bc_function) (const System & system,
                                          const Point & p,
                                          const std::string & var_name);
+
+private:
+
+  /**
+   * Class to integrate the flux jumps on a range of faces in
+   * parallel.  Each thread uses its own FE objects and accumulates
+   * into its own scratch buffer, which is merged into the shared
+   * ErrorVector once per range, so the face loop itself needs no
+   * locking.
+   */
+  class EstimateError
+  {
+  public:
+    EstimateError (const System & sys,
+                   const KellyErrorEstimator & ee,
+                   const std::vector<std::pair<const Elem *, unsigned char>> & face_list,
+                   ErrorVector & epc) :
+      system(sys),
+      error_estimator(ee),
+      faces(face_list),
+      error_per_cell(epc)
+    {}
+
+    void operator()(const Threads::BlockedRange<std::size_t> & range) const;
+
+  private:
+    const System & system;
+    const KellyErrorEstimator & error_estimator;
+    const std::vector<std::pair<const Elem *, unsigned char>> & faces;
+    ErrorVector & error_per_cell;
+  };
+
+  friend class EstimateError;
 };
 
 
@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <map>
 
 namespace libMesh
 {
@@ -646,6 +647,14 @@ protected:
   ElemType last_side;
 
   unsigned int last_edge;
+
+  /**
+   * A recycled side element for use in side reinits.
+   * Elem::build_side_ptr() re-points it at each new parent's nodes,
+   * replacing it only when the side type changes, so side traversal
+   * does not pay for a heap allocation per reinit.
+   */
+  std::unique_ptr<const Elem> recycled_side;
 };
 
 
@@ -849,6 +858,37 @@ public:
    */
   static void init_subdivision_matrix(DenseMatrix<Real> & A,
                                       unsigned int valence);
+
+private:
+
+  /**
+   * The basis tables built by init_shape_functions() depend only on
+   * the valence of the element's (single, by construction of the
+   * mesh) irregular vertex and on the quadrature points, not on the
+   * element itself, and a typical shell mesh contains only a handful
+   * of distinct valences.  This struct holds one fully tabulated
+   * basis so it can be reused by every element sharing that valence.
+   */
+  struct TabulatedBasis
+  {
+    std::vector<std::vector<Real>> phi;
+    std::vector<std::vector<RealGradient>> dphi;
+    std::vector<std::vector<Real>> dphidxi;
+    std::vector<std::vector<Real>> dphideta;
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    std::vector<std::vector<RealTensor>> d2phi;
+    std::vector<std::vector<Real>> d2phidxi2;
+    std::vector<std::vector<Real>> d2phidxideta;
+    std::vector<std::vector<Real>> d2phideta2;
+#endif
+  };
+
+  /**
+   * Basis tables previously computed at the quadrature points,
+   * keyed by vertex valence.  Cleared whenever a new quadrature
+   * rule is attached.
+   */
+  std::map<unsigned int, TabulatedBasis> _basis_cache;
 };
 
 
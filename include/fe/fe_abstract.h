@@ -41,6 +41,7 @@ enum ElemType : int;
 
 // C++ includes
 #include <cstddef>
+#include <string>
 #include <vector>
 #include <memory>
 
@@ -585,6 +586,34 @@ public:
    */
   void set_calculate_dual(const bool val){calculate_dual = val; }
 
+  /**
+   * Opens a scoped calculation request window.  The expensive
+   * differentiation tiers (second derivatives, curls, and
+   * divergences) are dropped and requests are reopened, so the get_
+   * accessors may re-select exactly what the next assembly phase
+   * needs; shape data is retabulated from the new request set at the
+   * next \p reinit().  Re-request data between this call and that
+   * \p reinit(), just as after construction.
+   */
+  void begin_calculation_request_window();
+
+  /**
+   * Closes the window opened by \p
+   * begin_calculation_request_window(), keeping any requests made
+   * inside it and restoring those dropped when it opened.  Shape data
+   * is again retabulated at the next \p reinit().
+   */
+  void end_calculation_request_window();
+
+  /**
+   * \returns The names of calculation tiers ("phi", "dphi", "d2phi",
+   * "curl_phi", "div_phi") which have been requested and tabulated
+   * but not read back through a get_ accessor since the last request
+   * window opened (or since construction).  Useful for auditing
+   * kernels that pay for differentiation data they never use.
+   */
+  std::vector<std::string> unread_calculations() const;
+
 protected:
 
   /**
@@ -666,6 +695,30 @@ protected:
    */
   mutable bool calculate_dphiref;
 
+  /**
+   * Are we inside a begin/end_calculation_request_window() pair?
+   */
+  bool in_request_window;
+
+  /**
+   * Calculation requests dropped by the current request window, to
+   * be merged back in by end_calculation_request_window().
+   */
+  bool saved_calculate_d2phi;
+  bool saved_calculate_curl_phi;
+  bool saved_calculate_div_phi;
+
+  /**
+   * Has each requested calculation tier been read back through a
+   * get_ accessor since the last request window opened?  Consulted
+   * by unread_calculations().
+   */
+  mutable bool phi_read;
+  mutable bool dphi_read;
+  mutable bool d2phi_read;
+  mutable bool curl_phi_read;
+  mutable bool div_phi_read;
+
 
   /**
    * The finite element type for this object.
@@ -22,6 +22,7 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/aligned_allocator.h"
 #include "libmesh/compare_types.h"
 #include "libmesh/fe_abstract.h"
 #include "libmesh/fe_transformation_base.h"
@@ -206,7 +207,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_phi() const
   { libmesh_assert(!calculations_started || calculate_phi);
-    calculate_phi = true; return phi; }
+    calculate_phi = true; phi_read |= calculations_started; return phi; }
 
   const std::vector<std::vector<OutputShape>> & get_dual_phi() const
   {
@@ -231,11 +232,11 @@ public:
    */
   const std::vector<std::vector<OutputGradient>> & get_dphi() const
   { libmesh_assert(!calculations_started || calculate_dphi);
-    calculate_dphi = calculate_dphiref = true; return dphi; }
+    calculate_dphi = calculate_dphiref = true; dphi_read |= calculations_started; return dphi; }
 
   const std::vector<std::vector<OutputGradient>> & get_dual_dphi() const
   { libmesh_assert(!calculations_started || calculate_dphi);
-    calculate_dphi = calculate_dual = calculate_dphiref = true; return dual_dphi; }
+    calculate_dphi = calculate_dual = calculate_dphiref = true; dphi_read |= calculations_started; return dual_dphi; }
 
   void request_dphi() const override
   { get_dphi(); }
@@ -253,7 +254,7 @@ public:
   virtual_for_inffe
   const std::vector<std::vector<OutputShape>> & get_curl_phi() const
   { libmesh_assert(!calculations_started || calculate_curl_phi);
-    calculate_curl_phi = calculate_dphiref = true; return curl_phi; }
+    calculate_curl_phi = calculate_dphiref = true; curl_phi_read |= calculations_started; return curl_phi; }
 
   /**
    * \returns The divergence of the shape function at the quadrature
@@ -262,7 +263,7 @@ public:
   virtual_for_inffe
   const std::vector<std::vector<OutputDivergence>> & get_div_phi() const
   { libmesh_assert(!calculations_started || calculate_div_phi);
-    calculate_div_phi = calculate_dphiref = true; return div_phi; }
+    calculate_div_phi = calculate_dphiref = true; div_phi_read |= calculations_started; return div_phi; }
 
   /**
    * \returns The shape function x-derivative at the quadrature
@@ -270,7 +271,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_dphidx() const
   { libmesh_assert(!calculations_started || calculate_dphi);
-    calculate_dphi = calculate_dphiref = true; return dphidx; }
+    calculate_dphi = calculate_dphiref = true; dphi_read |= calculations_started; return dphidx; }
 
   /**
    * \returns The shape function y-derivative at the quadrature
@@ -278,7 +279,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_dphidy() const
   { libmesh_assert(!calculations_started || calculate_dphi);
-    calculate_dphi = calculate_dphiref = true; return dphidy; }
+    calculate_dphi = calculate_dphiref = true; dphi_read |= calculations_started; return dphidy; }
 
   /**
    * \returns The shape function z-derivative at the quadrature
@@ -286,7 +287,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_dphidz() const
   { libmesh_assert(!calculations_started || calculate_dphi);
-    calculate_dphi = calculate_dphiref = true; return dphidz; }
+    calculate_dphi = calculate_dphiref = true; dphi_read |= calculations_started; return dphidz; }
 
   /**
    * \returns The shape function xi-derivative at the quadrature
@@ -320,11 +321,11 @@ public:
    */
   const std::vector<std::vector<OutputTensor>> & get_d2phi() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phi; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phi; }
 
   const std::vector<std::vector<OutputTensor>> & get_dual_d2phi() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dual = calculate_dphiref = true; return dual_d2phi; }
+    calculate_d2phi = calculate_dual = calculate_dphiref = true; d2phi_read |= calculations_started; return dual_d2phi; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -332,7 +333,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidx2() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidx2; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidx2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -340,7 +341,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidxdy() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidxdy; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidxdy; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -348,7 +349,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidxdz() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidxdz; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidxdz; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -356,7 +357,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidy2() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi =  calculate_dphiref = true; return d2phidy2; }
+    calculate_d2phi =  calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidy2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -364,7 +365,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidydz() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidydz; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidydz; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -372,7 +373,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidz2() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidz2; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidz2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -380,7 +381,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidxi2() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidxi2; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidxi2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -388,7 +389,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidxideta() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidxideta; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidxideta; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -396,7 +397,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidxidzeta() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidxidzeta; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidxidzeta; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -404,7 +405,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phideta2() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phideta2; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phideta2; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -412,7 +413,7 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidetadzeta() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidetadzeta; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidetadzeta; }
 
   /**
    * \returns The shape function second derivatives at the quadrature
@@ -420,10 +421,74 @@ public:
    */
   const std::vector<std::vector<OutputShape>> & get_d2phidzeta2() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
-    calculate_d2phi = calculate_dphiref = true; return d2phidzeta2; }
+    calculate_d2phi = calculate_dphiref = true; d2phi_read |= calculations_started; return d2phidzeta2; }
 
 #endif //LIBMESH_ENABLE_SECOND_DERIVATIVES
 
+  /**
+   * The byte alignment every flat_ view's buffer is guaranteed to
+   * start on: enough for a cache line or the widest common SIMD
+   * registers.
+   */
+  static const std::size_t flat_alignment = 64;
+
+  /**
+   * \returns A flat, contiguous, flat_alignment-byte-aligned,
+   * qp-major view of the shape function values: entry qp*n_sf + i
+   * holds the value of shape function i at quadrature point qp.
+   *
+   * The flat views are filled lazily from the tabulated data, stay
+   * valid until the next reinit(), and live inside this object, so
+   * SIMD kernels need no per-element staging copies of their own.
+   * The corresponding tier must have been requested before reinit(),
+   * just as for get_phi().
+   */
+  const OutputShape * flat_phi_qp_major () const
+  { libmesh_assert(calculate_phi);
+    phi_read |= calculations_started;
+    this->update_flat_data(); return _flat_phi_qp_major.data(); }
+
+  /**
+   * \returns The basis-major counterpart of flat_phi_qp_major():
+   * entry i*n_qp + qp holds the value of shape function i at
+   * quadrature point qp.
+   */
+  const OutputShape * flat_phi_basis_major () const
+  { libmesh_assert(calculate_phi);
+    phi_read |= calculations_started;
+    this->update_flat_data(); return _flat_phi_basis_major.data(); }
+
+  /**
+   * \returns A flat aligned qp-major view of the shape function
+   * derivatives in direction \p d (0, 1 or 2, up to the element
+   * dimension), indexed like flat_phi_qp_major().  One structure-of-
+   * arrays buffer per spatial component.
+   */
+  const OutputShape * flat_dphi_qp_major (const unsigned int d) const
+  { libmesh_assert(calculate_dphi);
+    libmesh_assert_less(d, 3);
+    dphi_read |= calculations_started;
+    this->update_flat_data(); return _flat_dphi_qp_major[d].data(); }
+
+  /**
+   * \returns The basis-major counterpart of flat_dphi_qp_major().
+   */
+  const OutputShape * flat_dphi_basis_major (const unsigned int d) const
+  { libmesh_assert(calculate_dphi);
+    libmesh_assert_less(d, 3);
+    dphi_read |= calculations_started;
+    this->update_flat_data(); return _flat_dphi_basis_major[d].data(); }
+
+  /**
+   * \returns A flat_alignment-byte-aligned copy of the Jacobian
+   * times quadrature weight vector, one entry per quadrature point.
+   * Map data must have been requested before reinit(), just as for
+   * get_JxW().
+   */
+  const Real * flat_JxW () const
+  { libmesh_assert(calculate_map);
+    this->update_flat_data(); return _flat_JxW.data(); }
+
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
   /**
@@ -601,12 +666,39 @@ protected:
    */
   void compute_dual_shape_functions();
 
+  /**
+   * Refills the flat aligned views from the tabulated shape data if
+   * they have gone stale since the last shape computation.
+   */
+  void update_flat_data () const;
+
   /**
    * Object that handles computing shape function values, gradients, etc
    * in the physical domain.
    */
   std::unique_ptr<FETransformationBase<OutputType>> _fe_trans;
 
+  /**
+   * Container type for the flat aligned views.
+   */
+  typedef std::vector<OutputShape, AlignedAllocator<OutputShape>>
+    aligned_shape_vector;
+
+  /**
+   * The flat aligned views handed out by the flat_ accessors, filled
+   * lazily by update_flat_data().
+   */
+  mutable aligned_shape_vector _flat_phi_qp_major;
+  mutable aligned_shape_vector _flat_phi_basis_major;
+  mutable aligned_shape_vector _flat_dphi_qp_major[3];
+  mutable aligned_shape_vector _flat_dphi_basis_major[3];
+  mutable std::vector<Real, AlignedAllocator<Real>> _flat_JxW;
+
+  /**
+   * Do the flat views match the most recent shape computation?
+   */
+  mutable bool _flat_data_current;
+
   /**
    * Shape function values.
    */
@@ -827,6 +919,7 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
                                          const FEType & fet) :
   FEAbstract(d,fet),
   _fe_trans( FETransformationBase<OutputType>::build(fet) ),
+  _flat_data_current(false),
   phi(),
   dual_phi(),
   dphi(),
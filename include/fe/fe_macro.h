@@ -65,38 +65,47 @@
 #endif // LIBMESH_ENABLE_INFINITE_ELEMENTS
 
 
-#ifndef LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
+// The rarely-used families may be pruned from the build at configure
+// time (--disable-exotic-fe-families) to shrink the library.
+#ifdef LIBMESH_ENABLE_EXOTIC_FE_FAMILIES
 
-#define INSTANTIATE_FE(_dim)   template class FE< (_dim), CLOUGH>;      \
+#define INSTANTIATE_EXOTIC_FE(_dim)  template class FE< (_dim), CLOUGH>; \
   template class FE< (_dim), HERMITE>;                                  \
   template class FE< (_dim), HIERARCHIC>;                               \
   template class FE< (_dim), L2_HIERARCHIC>;                            \
-  template class FE< (_dim), LAGRANGE>;                                 \
+  template class FE< (_dim), XYZ>
+
+#else //LIBMESH_ENABLE_EXOTIC_FE_FAMILIES
+
+#define INSTANTIATE_EXOTIC_FE(_dim)
+
+#endif //LIBMESH_ENABLE_EXOTIC_FE_FAMILIES
+
+
+#ifndef LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
+
+#define INSTANTIATE_FE(_dim)   template class FE< (_dim), LAGRANGE>;    \
   template class FE< (_dim), LAGRANGE_VEC>;                             \
   template class FE< (_dim), L2_LAGRANGE>;                              \
   template class FE< (_dim), MONOMIAL>;                                 \
   template class FE< (_dim), SCALAR>;                                   \
-  template class FE< (_dim), XYZ>;                                      \
   template class FE< (_dim), NEDELEC_ONE>;                              \
-  template class FE< (_dim), MONOMIAL_VEC>
+  template class FE< (_dim), MONOMIAL_VEC>;                             \
+  INSTANTIATE_EXOTIC_FE(_dim)
 
 #else //LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
 
-#define INSTANTIATE_FE(_dim)   template class FE< (_dim), CLOUGH>;      \
-  template class FE< (_dim), HERMITE>;                                  \
-  template class FE< (_dim), HIERARCHIC>;                               \
-  template class FE< (_dim), L2_HIERARCHIC>;                            \
-  template class FE< (_dim), LAGRANGE>;                                 \
+#define INSTANTIATE_FE(_dim)   template class FE< (_dim), LAGRANGE>;    \
   template class FE< (_dim), LAGRANGE_VEC>;                             \
   template class FE< (_dim), L2_LAGRANGE>;                              \
   template class FE< (_dim), MONOMIAL>;                                 \
   template class FE< (_dim), SCALAR>;                                   \
   template class FE< (_dim), BERNSTEIN>;                                \
   template class FE< (_dim), SZABAB>;                                   \
-  template class FE< (_dim), XYZ>;                                      \
   template class FE< (_dim), RATIONAL_BERNSTEIN>;                       \
   template class FE< (_dim), NEDELEC_ONE>;                              \
-  template class FE< (_dim), MONOMIAL_VEC>
+  template class FE< (_dim), MONOMIAL_VEC>;                             \
+  INSTANTIATE_EXOTIC_FE(_dim)
 
 #endif //LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
 
@@ -73,6 +73,25 @@ public:
                                 const std::vector<const Node *> & elem_nodes,
                                 bool compute_second_derivatives);
 
+  /**
+   * Batched equivalent of looping compute_single_point_map() over
+   * every quadrature point, used by compute_map() for the common
+   * first-derivative cases where the element dimension matches
+   * LIBMESH_DIM.  The calculate_* branching is hoisted out of the
+   * quadrature loops, the nodal accumulation runs along the
+   * contiguous per-point shape arrays, and one determinant/inversion
+   * kernel per element dimension finishes the map, so the inner
+   * loops vectorize.  Expects _elem_nodes to be set up already.
+   *
+   * \returns \p false, computing nothing, when the requested data
+   * needs the generalized per-point path (second derivatives or
+   * lower-dimensional manifold elements).
+   */
+  bool compute_batched_map(const unsigned int dim,
+                           const std::vector<Real> & qw,
+                           const Elem * elem,
+                           bool calculate_d2phi);
+
   /**
    * Compute the jacobian and some other additional
    * data fields. Takes the integration weights
@@ -188,6 +207,24 @@ public:
                             const bool secure = true,
                             const bool extra_checks = true);
 
+  /**
+   * As above, but starts the Newton iteration from the
+   * caller-provided \p initial_guess (in reference coordinates)
+   * instead of the origin of the reference element.  When queries
+   * exhibit temporal coherence -- e.g. tracking a particle through
+   * an element -- passing the previous reference point typically
+   * lets the iteration converge in a single step.  The choice of
+   * starting point does not affect the converged result on
+   * well-shaped elements, only the iteration count.
+   */
+  static Point inverse_map (const unsigned int dim,
+                            const Elem * elem,
+                            const Point & p,
+                            const Point & initial_guess,
+                            const Real tolerance = TOLERANCE,
+                            const bool secure = true,
+                            const bool extra_checks = true);
+
   /**
    * Takes a number points in physical space (in the \p
    * physical_points vector) and finds their location on the reference
@@ -629,6 +666,16 @@ public:
    */
   void add_calculations();
 
+  /**
+   * Preallocates the quadrature point data vectors for up to \p n_qp
+   * quadrature points, so that subsequent \p compute_map() calls can
+   * reuse that capacity instead of going back to the allocator.  The
+   * reservation only ever grows; in debug mode \p
+   * resize_quadrature_map_vectors() will then assert that no later
+   * call outgrows it.
+   */
+  void reserve_quadrature_map_vectors(const unsigned int dim, unsigned int n_qp);
+
   /**
    * Set the Jacobian tolerance used for determining when the mapping fails. The mapping is
    * determined to fail if jac <= jacobian_tolerance.
@@ -1036,6 +1083,13 @@ private:
    * Work vector for compute_affine_map()
    */
   std::vector<const Node *> _elem_nodes;
+
+  /**
+   * The largest quadrature point count passed to
+   * \p reserve_quadrature_map_vectors(), or 0 if no reservation has
+   * been made.
+   */
+  unsigned int _n_qp_reserved;
 };
 
 }
@@ -0,0 +1,194 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_REFERENCE_SHAPE_CACHE_H
+#define LIBMESH_REFERENCE_SHAPE_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/hashing.h"
+#include "libmesh/point.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A global cache of reference-element shape value tables.  For finite
+ * element families whose shape functions depend only on the reference
+ * element - i.e. families for which \p FE::shapes_need_reinit()
+ * returns \p false - the table of shape values at a given set of
+ * quadrature points is identical for every geometric element of the
+ * same type and p-refinement level.  Rather than re-evaluating those
+ * values on every \p reinit(), the shape transformation classes can
+ * look the table up here and fall back to direct evaluation only on a
+ * cache miss.
+ *
+ * Tables are keyed on the finite element type, the element type, the
+ * p-refinement level, and the quadrature point locations themselves,
+ * so rules with coincident point counts but different abscissae do
+ * not collide.  Insertion and lookup are guarded by a spin mutex, and
+ * lookups copy the cached table out under the lock, so the cache is
+ * safe to share between assembly threads.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief Cache of reference shape values shared across FE reinits.
+ */
+template <typename OutputShape>
+class ReferenceShapeCache
+{
+public:
+
+  /**
+   * The tables we cache: shape values indexed by shape function
+   * number, then by quadrature point number.
+   */
+  typedef std::vector<std::vector<OutputShape>> table_type;
+
+  /**
+   * \returns The global cache instance.
+   */
+  static ReferenceShapeCache & instance ()
+  {
+    static ReferenceShapeCache the_instance;
+    return the_instance;
+  }
+
+  /**
+   * Looks up the shape value table for finite element type \p fe_t on
+   * reference elements of type \p type at p-refinement level \p
+   * p_level, evaluated at the points \p qp.
+   *
+   * \returns \p true, with the cached values copied into \p phi, if
+   * the table was found; \p false, leaving \p phi untouched,
+   * otherwise.
+   */
+  bool lookup (const FEType & fe_t,
+               const ElemType type,
+               const unsigned int p_level,
+               const std::vector<Point> & qp,
+               table_type & phi) const
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+
+    auto it = _tables.find(this->key(fe_t, type, p_level, qp));
+    if (it == _tables.end())
+      return false;
+
+    // A table cached for the same quadrature points but a different
+    // number of shape functions (e.g. from an FE with a different
+    // add_p_level setting) is no use to us.
+    if (it->second.size() != phi.size())
+      return false;
+
+    phi = it->second;
+    return true;
+  }
+
+  /**
+   * Stores a copy of the shape value table \p phi under the key
+   * formed from \p fe_t, \p type, \p p_level, and \p qp.  Does
+   * nothing if an entry for that key already exists.
+   */
+  void insert (const FEType & fe_t,
+               const ElemType type,
+               const unsigned int p_level,
+               const std::vector<Point> & qp,
+               const table_type & phi)
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+
+    _tables.emplace(this->key(fe_t, type, p_level, qp), phi);
+  }
+
+  /**
+   * Drops all cached tables.
+   */
+  void clear ()
+  {
+    Threads::spin_mutex::scoped_lock lock(_mutex);
+
+    _tables.clear();
+  }
+
+private:
+
+  /**
+   * Private constructor; this is a singleton.
+   */
+  ReferenceShapeCache () = default;
+
+  /**
+   * The key under which a table is cached.  We store the quadrature
+   * point locations as a hash alongside their count, which keeps keys
+   * cheap to compare while still distinguishing rules that share a
+   * point count.
+   */
+  typedef std::tuple<int,            // FEFamily
+                     int,            // Order
+                     int,            // ElemType
+                     unsigned int,   // p_level
+                     std::size_t,    // hash of qp locations
+                     std::size_t>    // number of qp
+    key_type;
+
+  /**
+   * Builds the cache key for the given lookup parameters.
+   */
+  key_type key (const FEType & fe_t,
+                const ElemType type,
+                const unsigned int p_level,
+                const std::vector<Point> & qp) const
+  {
+    std::size_t points_hash = 0;
+    for (const Point & p : qp)
+      for (unsigned int d=0; d != LIBMESH_DIM; ++d)
+        boostcopy::hash_combine(points_hash, static_cast<double>(p(d)));
+
+    return key_type(static_cast<int>(fe_t.family),
+                    static_cast<int>(fe_t.order),
+                    static_cast<int>(type),
+                    p_level,
+                    points_hash,
+                    qp.size());
+  }
+
+  /**
+   * The cached tables.
+   */
+  std::map<key_type, table_type> _tables;
+
+  /**
+   * Mutex guarding \p _tables.
+   */
+  mutable Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_REFERENCE_SHAPE_CACHE_H
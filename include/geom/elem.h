@@ -138,6 +138,16 @@ public:
    */
   virtual ~Elem();
 
+  /**
+   * Class-specific allocation, shared by all Elem subclasses and
+   * routed through the global \p ObjectArena so that bulk mesh
+   * construction (generation, file readers) can place elements in
+   * nearly-contiguous type-segregated pooled storage.  Outside an
+   * arena-enabled scope this is ordinary heap allocation.
+   */
+  static void * operator new (std::size_t size);
+  static void operator delete (void * ptr, std::size_t size);
+
   /**
    * \returns The \p Point associated with local \p Node \p i.
    */
@@ -2356,6 +2366,10 @@ Elem::simple_build_side_ptr (std::unique_ptr<Elem> & side,
 #endif
       for (auto n : side->node_index_range())
         side->set_node(n) = this->node_ptr(Subclass::side_nodes_map[i][n]);
+
+      // A recycled side may have been built from another element;
+      // match what the fresh build above does.
+      side->set_interior_parent(this);
     }
 }
 
@@ -100,6 +100,15 @@ public:
    */
   ~Node ();
 
+  /**
+   * Class-specific allocation, routed through the global \p
+   * ObjectArena so that bulk mesh construction (generation, file
+   * readers) can place nodes in nearly-contiguous pooled storage.
+   * Outside an arena-enabled scope this is ordinary heap allocation.
+   */
+  static void * operator new (std::size_t size);
+  static void operator delete (void * ptr, std::size_t size);
+
   /**
    * Assign to a node from a point.
    */
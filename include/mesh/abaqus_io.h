@@ -26,6 +26,8 @@
 // C++ includes
 #include <fstream>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -191,6 +193,20 @@ private:
    */
   unsigned char max_elem_dimension_seen();
 
+  /**
+   * \returns The libmesh node id corresponding to \p abaqus_node_id,
+   * building the deferred node id mapping first if necessary.
+   */
+  dof_id_type libmesh_node_id(dof_id_type abaqus_node_id);
+
+  /**
+   * Builds the abaqus -> libmesh node id mapping from the list of ids
+   * recorded while reading *NODE sections.  In the common case of
+   * contiguous Abaqus node numbering no hash is built at all; lookups
+   * then reduce to subtracting a fixed offset.
+   */
+  void build_node_mapping();
+
   /**
    * Abaqus writes nodesets and elemsets with labels.  As we read
    * them in, we'll use these maps to provide a natural ordering for
@@ -215,8 +231,8 @@ private:
    * Map from libmesh element number -> abaqus element number,
    * and the converse.
    */
-  // std::map<dof_id_type, dof_id_type> _libmesh_to_abaqus_elem_mapping;
-  std::map<dof_id_type, dof_id_type> _abaqus_to_libmesh_elem_mapping;
+  // std::unordered_map<dof_id_type, dof_id_type> _libmesh_to_abaqus_elem_mapping;
+  std::unordered_map<dof_id_type, dof_id_type> _abaqus_to_libmesh_elem_mapping;
 
   /**
    * Map from abaqus node number -> sequential, 0-based libmesh node numbering.
@@ -224,9 +240,33 @@ private:
    * \note In every Abaqus file I've ever seen the node numbers were 1-based,
    * sequential, and all in order, so that this map is probably overkill.
    * Nevertheless, it is the most general solution in case we come across a
-   * weird Abaqus file some day.
+   * weird Abaqus file some day.  It is built lazily by
+   * build_node_mapping(), and not built at all when the numbering
+   * turns out to be contiguous.
+   */
+  std::unordered_map<dof_id_type, dof_id_type> _abaqus_to_libmesh_node_mapping;
+
+  /**
+   * The Abaqus node ids in the order their nodes were added to the
+   * Mesh, i.e. indexed by libmesh node id.  Recorded while reading
+   * *NODE sections so that build_node_mapping() can construct the
+   * node id mapping in one deferred pass.
+   */
+  std::vector<dof_id_type> _abaqus_node_ids;
+
+  /**
+   * True once build_node_mapping() has run; reset whenever another
+   * *NODE section is read.
+   */
+  bool _node_mapping_built;
+
+  /**
+   * True if build_node_mapping() found the Abaqus node numbering to
+   * be contiguous, in which case _node_id_offset is the Abaqus id of
+   * libmesh node 0 and no hash lookups are required.
    */
-  std::map<dof_id_type, dof_id_type> _abaqus_to_libmesh_node_mapping;
+  bool _node_ids_contiguous;
+  dof_id_type _node_id_offset;
 
   /**
    * This flag gets set to true after the first "*PART" section
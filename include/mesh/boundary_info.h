@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <tuple>
 
@@ -99,6 +100,17 @@ public:
    */
   void regenerate_id_sets ();
 
+  /**
+   * Builds the flattened per-element index used to answer side
+   * boundary id queries with a single O(1) hash lookup instead of a
+   * multimap search.  This is called automatically at the end of
+   * MeshBase::prepare_for_use(), and any modification of side
+   * associations invalidates the index again, so concurrent reads
+   * from multiple threads (e.g. inside threaded assembly loops) are
+   * safe whenever queries themselves are.
+   */
+  void build_side_id_cache ();
+
 
   /**
    * Generates \p boundary_mesh data structures corresponding to the
@@ -599,7 +611,10 @@ public:
 
   /**
    * Adds sides to a sideset if every node on that side are in the same
-   * sideset
+   * sideset.
+   *
+   * On a distributed mesh this pulls ghost nodes' boundary ids from
+   * their owners first, so it must be run on all processors at once.
    */
   void build_side_list_from_node_list();
 
@@ -634,6 +649,18 @@ public:
   enum class BCTupleSortBy {ELEM_ID, SIDE_ID, BOUNDARY_ID, UNSORTED};
   std::vector<BCTuple> build_side_list(BCTupleSortBy sort_by = BCTupleSortBy::ELEM_ID) const;
 
+  /**
+   * As above, but fills the caller's three arrays directly, without
+   * materializing the intermediate vector of tuples.  The arrays are
+   * sorted consistently with the tuple-returning overload; any prior
+   * contents are discarded.  Useful in tight memory situations or
+   * when the three-array layout is what a caller needs anyway.
+   */
+  void build_side_list (std::vector<dof_id_type> &        element_id_list,
+                        std::vector<unsigned short int> & side_list,
+                        std::vector<boundary_id_type> &   bc_id_list,
+                        BCTupleSortBy sort_by) const;
+
   /**
    * Creates a list of active element numbers, sides, and ids for those sides.
    *
@@ -889,6 +916,35 @@ private:
                 std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
+  /**
+   * A flattened copy of \p _boundary_side_id, grouping each
+   * element's (side, id) associations contiguously behind a single
+   * hash lookup.  Side queries in assembly loops consult this
+   * instead of searching the multimap, but only while
+   * \p _side_id_cache_valid; every modification of side
+   * associations invalidates it, and build_side_id_cache() rebuilds
+   * it.  Element pointers remain valid keys across renumbering, and
+   * element deletion passes through remove(), which invalidates us.
+   */
+  std::unordered_map<const Elem *,
+                     std::vector<std::pair<unsigned short int, boundary_id_type>>>
+  _side_id_cache;
+
+  /**
+   * \p true if \p _side_id_cache is current.
+   */
+  bool _side_id_cache_valid;
+
+  /**
+   * Discards \p _side_id_cache.  Called from every method which
+   * modifies side associations.
+   */
+  void invalidate_side_id_cache ()
+  {
+    _side_id_cache_valid = false;
+    _side_id_cache.clear();
+  }
+
   /**
    * A collection of user-specified boundary ids for sides, edges, nodes,
    * and shell faces.
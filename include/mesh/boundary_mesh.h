@@ -22,10 +22,19 @@
 
 // Local Includes
 #include "libmesh/mesh.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
 
+// Forward declarations
+class Elem;
+
 /**
  * The \p BoundaryMesh is a \p Mesh in its own right, but it
  * contains a description of the boundary of some other mesh.
@@ -50,6 +59,83 @@ public:
    * Destructor.
    */
   ~BoundaryMesh();
+
+  /**
+   * The result of a closest-point projection query: the surface
+   * element owning the projection (or \p nullptr if the mesh holds no
+   * elements), the reference coordinates of the projected point on
+   * that element, and the distance from the query point to the
+   * projection.
+   */
+  struct ClosestPointProjection
+  {
+    const Elem * elem;
+    Point xi;
+    Real distance;
+  };
+
+  /**
+   * Finds the approximate closest point on this surface to \p p: the
+   * nearest surface node is located through the node KD-tree cache,
+   * and the faces sharing that node are ranked by an unbounded
+   * inverse map clamped back into each face's reference domain.  The
+   * caches this uses are invalidated along with the PointLocator, so
+   * code which moves nodes by hand (or via sync_node_positions())
+   * gets a rebuild on the next query.
+   *
+   * On a distributed mesh only the locally stored portion of the
+   * surface is searched; queries far from the local partition may
+   * need their results reduced across processors by the caller.
+   */
+  ClosestPointProjection project_closest_point (const Point & p) const;
+
+  /**
+   * Batched version of project_closest_point().  The caches are
+   * prepared up front and the queries then run concurrently via
+   * Threads::parallel_for(); \p results is resized to match \p
+   * queries.  Concurrent queries are safe, concurrent mesh
+   * modification is not.
+   */
+  void project_closest_points (const std::vector<Point> & queries,
+                               std::vector<ClosestPointProjection> & results) const;
+
+  /**
+   * Copies current node positions over from the \p interior_mesh this
+   * boundary mesh was sync()ed from, using the \p node_id_map
+   * obtained from BoundaryInfo::get_side_and_node_maps(), and
+   * invalidates the position-dependent caches.  This lets a contact
+   * search keep one BoundaryMesh alive across timesteps of a moving
+   * mesh instead of re-syncing the whole surface.
+   */
+  void sync_node_positions (const MeshBase & interior_mesh,
+                            const std::map<dof_id_type, dof_id_type> & node_id_map);
+
+private:
+
+  /**
+   * Builds (or rebuilds, if the mesh generation() has moved on) the
+   * node-to-face adjacency and node KD-tree caches the projection
+   * queries use.  Must be called outside any threaded region.
+   */
+  void prepare_projection_caches () const;
+
+  /**
+   * Projects a single point assuming prepare_projection_caches() has
+   * already run; safe to call concurrently.
+   */
+  ClosestPointProjection project_one_point (const Point & p) const;
+
+  /**
+   * Faces adjacent to each surface node, keyed by node id.
+   */
+  mutable std::unordered_map<dof_id_type, std::vector<const Elem *>> _nodes_to_elem_map;
+
+  /**
+   * Whether the projection caches have been built, and the mesh
+   * generation() they were built at.
+   */
+  mutable bool _projection_caches_built;
+  mutable unsigned long _projection_generation;
 };
 
 } // namespace libMesh
@@ -23,12 +23,14 @@
 
 // Local includes
 #include "libmesh/compare_elems_by_level.h"
+#include "libmesh/mesh_file_metadata.h"
 #include "libmesh/mesh_input.h"
 #include "libmesh/mesh_output.h"
 #include "libmesh/parallel_object.h"
 
 // C++ includes
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace libMesh
@@ -101,6 +103,28 @@ public:
    */
   virtual void read (const std::string & input_name) override;
 
+  /**
+   * Reads summary metadata from the checkpoint header of \p
+   * input_name without constructing any Elem objects or modifying the
+   * MeshBase.  The header records the mesh dimension and the
+   * subdomain/sideset/nodeset *name* maps, so the id sets returned
+   * contain only the named ids and their \p have_* flags stay \p
+   * false; counts and the bounding box live in the split files and
+   * are not read.
+   */
+  MeshFileMetadata read_metadata (const std::string & input_name);
+
+  /**
+   * Starts pulling the checkpoint files that a subsequent read() of
+   * \p input_name will need into the OS file cache on a background
+   * thread, so the disk traffic overlaps whatever initialization the
+   * application performs before actually reading the mesh.  This is
+   * purely a prefetch: no mesh data is touched, no communication is
+   * performed, and calling it is always optional.  read() (and the
+   * destructor) synchronize with the prefetch thread via wait().
+   */
+  void begin_read_prefetch (const std::string & input_name);
+
   /**
    * This method implements writing a mesh to a specified file.  If the mesh has been split
    * for running on several processors, this will create a subdirectory named
@@ -152,7 +176,44 @@ public:
   bool & parallel()       { return _parallel; }
 
   /**
-   * Get/Set the version string.
+   * Get/Set the flag enabling partition-consistent restarts across
+   * differing processor counts.  When true (it is false by default)
+   * and a parallel checkpoint written as N splits is read on M ranks,
+   * read() assigns each rank the contiguous block of split files
+   * whose union forms its final partition, remaps the stored
+   * processor ids with the same block mapping, and marks the mesh to
+   * skip repartitioning.  The decomposition that comes off disk is
+   * then final: no post-read redistribution takes place.  This is
+   * aimed at elastic-allocation restarts where N is a multiple of M,
+   * e.g. a 4096-way split read on 1024 ranks with four files apiece.
+   */
+  bool   keep_split_partition() const { return _keep_split_partition; }
+  bool & keep_split_partition()       { return _keep_split_partition; }
+
+  /**
+   * Get/Set the flag controlling background compression.  When true
+   * (it is false by default) and a non-binary checkpoint is written
+   * to a ".gz" name, write() streams each split file to disk
+   * uncompressed and compresses it afterwards on a background thread,
+   * copying through the gzip stream in fixed-size chunks.  The
+   * deflate cost then overlaps subsequent computation instead of
+   * stalling the simulation, and the compressor's peak memory stays
+   * bounded by the chunk size.  Call wait() (or rely on the
+   * destructor) before reading the files back.
+   */
+  bool   background_compression() const { return _background_compression; }
+  bool & background_compression()       { return _background_compression; }
+
+  /**
+   * Blocks until all background threads started by write() or
+   * begin_read_prefetch() have finished.
+   */
+  void wait ();
+
+  /**
+   * Get/Set the version string.  When reading, this is overwritten by
+   * the version found in the input file's header, so the split files'
+   * formats are keyed off what was actually written.
    */
   const std::string & version () const { return _version; }
   std::string &       version ()       { return _version; }
@@ -166,6 +227,18 @@ public:
    */
   bool version_at_least_1_5() const;
 
+  /**
+   * \returns \p true if the current file has an XDR/XDA version that
+   * matches or exceeds 1.6
+   *
+   * As of this version we encode element connectivity in blocks of
+   * delta+varint encoded node ids rather than as raw 64-bit ids,
+   * which after a locality-preserving renumbering shrinks checkpoint
+   * files severalfold.  Set an older version string before writing to
+   * produce files readable by older libraries.
+   */
+  bool version_at_least_1_6() const;
+
   /**
    * Get/Set the processor id or processor ids to use.
    *
@@ -207,6 +280,14 @@ private:
   void write_connectivity (Xdr & io,
                            const std::set<const Elem *, CompareElemIdsByLevel> & elements) const;
 
+  /**
+   * Write \p conn, the concatenated node ids of every element, as
+   * blocks of delta+varint encoded values with per-block checksums
+   * ("checkpoint-1.6" and later files).
+   */
+  void write_connectivity_blocks (Xdr & io,
+                                  const std::vector<largest_id_type> & conn) const;
+
   /**
    * Write the remote_elem neighbor and child links for part of a mesh
    */
@@ -250,6 +331,14 @@ private:
   template <typename file_id_type>
   file_id_type read_header(const std::string & name);
 
+  /**
+   * Parse the header sections following the data size into \p meta.
+   * Unlike read_header(), nothing is stored in the MeshBase.  Helper
+   * for read_metadata(); only runs on processor 0.
+   */
+  template <typename file_id_type>
+  void read_metadata_impl(Xdr & io, MeshFileMetadata & meta);
+
   /**
    * Read a non-header file
    */
@@ -268,6 +357,16 @@ private:
   template <typename file_id_type>
   void read_connectivity (Xdr & io);
 
+  /**
+   * Read back the concatenated node ids written by \p
+   * write_connectivity_blocks().  Every block is verified against its
+   * stored checksum, and since each block resets the delta predictor
+   * the blocks are decoded concurrently.  Block quantities are always
+   * 64-bit, independent of \p file_id_type, so this is not templated.
+   */
+  void read_connectivity_blocks (Xdr & io,
+                                 std::vector<largest_id_type> & conn) const;
+
   /**
    * Read the remote_elem neighbor and child links for a parallel, distributed mesh
    *
@@ -324,15 +423,44 @@ private:
 
   processor_id_type select_split_config(const std::string & input_name, header_id_type & data_size);
 
+  /**
+   * \returns The rank which should own an object whose stored
+   * processor id is \p stored_pid.
+   *
+   * By default ids "wrap around" modulo our processor count.  Under a
+   * keep_split_partition() read of more splits than we have ranks,
+   * contiguous blocks of stored ids map to each rank instead, so that
+   * every object lands on the rank which read its split file.
+   */
+  processor_id_type target_processor (largest_id_type stored_pid) const;
+
   bool _binary;
   bool _parallel;
+  bool _keep_split_partition;
+  bool _background_compression;
   std::string _version;
 
+  /**
+   * Background compression threads started by write(), joined by
+   * wait() or the destructor.
+   */
+  std::vector<std::thread> _compression_threads;
+
+  /**
+   * Background file prefetch thread started by begin_read_prefetch(),
+   * joined by wait() or the destructor.
+   */
+  std::thread _prefetch_thread;
+
   // The processor ids to write
   std::vector<processor_id_type> _my_processor_ids;
 
   // The largest processor id to write
   processor_id_type _my_n_processors;
+
+  // The number of splits in the file set being read, for use by
+  // target_processor(); 0 when not reading a parallel checkpoint
+  processor_id_type _reading_n_splits;
 };
 
 
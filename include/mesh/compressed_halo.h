@@ -0,0 +1,202 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_COMPRESSED_HALO_H
+#define LIBMESH_COMPRESSED_HALO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+#include "libmesh/enum_elem_type.h"
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+class DofMap;
+class Elem;
+class Node;
+
+/**
+ * The CompressedHalo class captures, in a few contiguous read-only
+ * arrays, just the data assembly-side evaluation needs from the
+ * remote elements ghosted on this processor: element types, ids,
+ * node connectivity against a deduplicated node coordinate table,
+ * and optionally dof indices.  It keeps no neighbor graphs and no
+ * AMR bookkeeping, so with wide ghosting stencils (e.g. many ranks
+ * per node) it is several times smaller than the full Elem and Node
+ * objects it summarizes.
+ *
+ * A typical use packs the ghost layer once after ghosting functors
+ * such as GhostPointNeighbors have run, then releases the full
+ * objects via DistributedMesh::delete_remote_elements() and serves
+ * halo queries from the packed arrays, inflating a complete
+ * standalone Elem only where one is really needed.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief Packed read-only storage for a processor's ghost element layer.
+ */
+class CompressedHalo
+{
+public:
+
+  /**
+   * Constructor.  Takes a reference to the mesh whose ghost layer is
+   * to be packed; no packing happens until \p pack() is called.
+   */
+  explicit CompressedHalo (const MeshBase & mesh);
+
+  /**
+   * Packs the mesh's current ghost layer - every active element not
+   * owned by this processor - replacing any previous contents.  If a
+   * \p dof_map is supplied, each halo element's dof indices are
+   * packed too, enabling dof queries after the full elements are
+   * deleted.
+   */
+  void pack (const DofMap * dof_map = nullptr);
+
+  /**
+   * Releases all packed storage.
+   */
+  void clear ();
+
+  /**
+   * \returns The number of packed halo elements.
+   */
+  std::size_t n_halo_elems () const { return _elem_ids.size(); }
+
+  /**
+   * \returns The number of distinct nodes in the packed halo.
+   */
+  std::size_t n_halo_nodes () const { return _node_ids.size(); }
+
+  /**
+   * \returns The packed index of the halo element with id \p elem_id;
+   * throws an error if no such element was packed.
+   */
+  std::size_t halo_index (dof_id_type elem_id) const;
+
+  /**
+   * \returns The type of the \p i th halo element.
+   */
+  ElemType halo_elem_type (std::size_t i) const;
+
+  /**
+   * \returns The id of the \p i th halo element.
+   */
+  dof_id_type halo_elem_id (std::size_t i) const;
+
+  /**
+   * \returns The owning processor of the \p i th halo element.
+   */
+  processor_id_type halo_elem_processor_id (std::size_t i) const;
+
+  /**
+   * \returns The subdomain of the \p i th halo element.
+   */
+  subdomain_id_type halo_elem_subdomain_id (std::size_t i) const;
+
+  /**
+   * \returns The node count of the \p i th halo element.
+   */
+  unsigned int halo_elem_n_nodes (std::size_t i) const;
+
+  /**
+   * \returns The id of local node \p n of the \p i th halo element.
+   */
+  dof_id_type halo_node_id (std::size_t i, unsigned int n) const;
+
+  /**
+   * \returns The location of local node \p n of the \p i th halo
+   * element.
+   */
+  Point halo_point (std::size_t i, unsigned int n) const;
+
+  /**
+   * Fills \p di with the dof indices packed for the \p i th halo
+   * element.  Only valid if \p pack() was given a DofMap.
+   */
+  void halo_dof_indices (std::size_t i,
+                         std::vector<dof_id_type> & di) const;
+
+  /**
+   * Inflates the \p i th halo element back into a full standalone
+   * Elem, building fresh Node objects into the caller's \p
+   * node_storage, which must outlive the returned element.  Nodes are
+   * not deduplicated between inflate() calls.
+   */
+  std::unique_ptr<Elem> inflate (std::size_t i,
+                                 std::vector<std::unique_ptr<Node>> & node_storage) const;
+
+  /**
+   * \returns The total bytes held by the packed arrays, for memory
+   * accounting.
+   */
+  std::size_t packed_bytes () const;
+
+private:
+
+  /**
+   * The mesh whose ghost layer we pack
+   */
+  const MeshBase & _mesh;
+
+  /**
+   * Ids of the packed halo elements, in ascending order
+   */
+  std::vector<dof_id_type> _elem_ids;
+
+  /**
+   * Per-element type, owner, and subdomain
+   */
+  std::vector<unsigned char> _elem_types;
+  std::vector<processor_id_type> _elem_procs;
+  std::vector<subdomain_id_type> _elem_subdomains;
+
+  /**
+   * CSR connectivity: element \p i 's nodes are the node-table
+   * indices in [_elem_node_offsets[i], _elem_node_offsets[i+1])
+   */
+  std::vector<std::size_t> _elem_node_offsets;
+  std::vector<unsigned int> _elem_nodes;
+
+  /**
+   * CSR dof indices, filled only when pack() is given a DofMap
+   */
+  std::vector<std::size_t> _elem_dof_offsets;
+  std::vector<dof_id_type> _elem_dofs;
+
+  /**
+   * Deduplicated node table: ids in ascending order, with three
+   * coordinates per node
+   */
+  std::vector<dof_id_type> _node_ids;
+  std::vector<Real> _node_coords;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_COMPRESSED_HALO_H
@@ -210,6 +210,18 @@ public:
    */
   virtual void add_extra_ghost_elem(Elem * e);
 
+  /**
+   * Collectively gathers the elements whose ids are in \p
+   * requested_ids but which are not present locally from their
+   * owners, and inserts them as extra ghost elements which
+   * delete_remote_elements() will keep.  This lets ghost elements
+   * outside the eagerly-materialized halos be fetched on demand; the
+   * memory they hold can be bounded by evicting them with
+   * clear_extra_ghost_elems() followed by a (collective)
+   * delete_remote_elements() call.
+   */
+  virtual void gather_extra_ghost_elems(const std::set<dof_id_type> & requested_ids);
+
   /**
    * Clears extra ghost elements.
    */
@@ -237,6 +249,14 @@ public:
   // Parallel only method to update the caches
   virtual void update_parallel_id_counts () override;
 
+  /**
+   * Leases each processor a contiguous block of element and node ids
+   * just past the current id range; see MeshBase::reserve_local_ids().
+   * This function must be run on all processors at once.
+   */
+  virtual void reserve_local_ids (dof_id_type n_elems,
+                                  dof_id_type n_nodes) override;
+
   // And more parallel only methods to test non-cached values
   virtual dof_id_type parallel_n_nodes () const override;
   dof_id_type parallel_max_node_id () const;
@@ -287,6 +307,7 @@ public:
 
   virtual void delete_node (Node * n) override;
   virtual void renumber_node (dof_id_type old_id, dof_id_type new_id) override;
+  virtual void renumber_nodes (const std::vector<dof_id_type> & new_ids) override;
   virtual Elem * add_elem (Elem * e) override;
   virtual Elem * add_elem (std::unique_ptr<Elem> e) override;
   virtual Elem * insert_elem (Elem * e) override;
@@ -417,6 +438,15 @@ public:
   virtual const_element_iterator active_type_elements_begin (ElemType type) const override;
   virtual const_element_iterator active_type_elements_end (ElemType type) const override;
 
+  virtual element_iterator active_local_type_elements_begin (ElemType type) override;
+  virtual element_iterator active_local_type_elements_end (ElemType type) override;
+  virtual const_element_iterator active_local_type_elements_begin (ElemType type) const override;
+  virtual const_element_iterator active_local_type_elements_end (ElemType type) const override;
+  virtual SimpleRange<element_iterator> active_local_type_elements_ptr_range(ElemType type) override
+  { return {active_local_type_elements_begin(type), active_local_type_elements_end(type)}; }
+  virtual SimpleRange<const_element_iterator> active_local_type_elements_ptr_range(ElemType type) const override
+  { return {active_local_type_elements_begin(type), active_local_type_elements_end(type)}; }
+
   virtual element_iterator active_pid_elements_begin (processor_id_type proc_id) override;
   virtual element_iterator active_pid_elements_end (processor_id_type proc_id) override;
   virtual const_element_iterator active_pid_elements_begin (processor_id_type proc_id) const override;
@@ -583,6 +613,15 @@ protected:
   dof_id_type _next_free_unpartitioned_node_id,
     _next_free_unpartitioned_elem_id;
 
+  /**
+   * Half-open ranges of contiguous ids leased to this processor by
+   * reserve_local_ids(), consumed before the interleaved sequences
+   * above when numbering new local objects.  Empty when no lease is
+   * active.
+   */
+  dof_id_type _reserved_elem_id_begin, _reserved_elem_id_end;
+  dof_id_type _reserved_node_id_begin, _reserved_node_id_end;
+
 #ifdef LIBMESH_ENABLE_UNIQUE_ID
   /**
    * The next available unique id for assigning ids to unpartitioned DOF objects
@@ -92,6 +92,23 @@ public:
                               unsigned int sys_num,
                               unsigned int var_num);
 
+  /**
+   * Sets whether \p read() maintains a binary sidecar cache (on by
+   * default).  With caching enabled, the first read of a file writes
+   * a versioned binary image of the parsed mesh and spline
+   * coefficient tables alongside the source file, and subsequent
+   * reads load that image instead of reparsing the text keyword
+   * format whenever the source file is unchanged.  A sidecar which
+   * cannot be written (e.g. in a read-only directory) or which fails
+   * validation is silently ignored.
+   */
+  void set_sidecar_caching (bool enabled) { _sidecar_caching = enabled; }
+
+  /**
+   * \returns Whether \p read() maintains a binary sidecar cache.
+   */
+  bool sidecar_caching () const { return _sidecar_caching; }
+
 private:
   // Keep track of spline node indexing, so as to enable adding
   // constraint rows easily later.
@@ -105,11 +122,42 @@ private:
    */
   void read_mesh (std::istream & in);
 
+  /**
+   * Tries to load the mesh from the binary sidecar cache \p
+   * cache_name.
+   *
+   * \returns \p true on success, \p false if the sidecar is missing,
+   * stale with respect to \p source_name, or written by an
+   * incompatible library build, in which case the caller falls back
+   * to parsing the text format.
+   */
+  bool read_sidecar (const std::string & cache_name,
+                     const std::string & source_name);
+
+  /**
+   * Writes the binary sidecar cache \p cache_name from the
+   * just-parsed mesh.  Failure to write is not an error; the next
+   * read simply reparses the text format.
+   */
+  void write_sidecar (const std::string & cache_name,
+                      const std::string & source_name);
+
+  /**
+   * Whether read() maintains a binary sidecar cache
+   */
+  bool _sidecar_caching;
+
   /**
    * The integer type DYNA uses
    */
   typedef int32_t dyna_int_type;
 
+  /**
+   * Format version stamped into sidecar caches; bump on any change
+   * to the sidecar layout
+   */
+  static const dyna_int_type sidecar_version = 1;
+
   /**
    * How many can we find on a line?
    */
@@ -173,14 +221,14 @@ private:
   };
 
   /**
-   * A static ElementMaps object that is built statically and used by
-   * all instances of this class.
+   * \returns The ElementMaps object shared by all instances of this
+   * class, built thread-safely on first use so that programs which
+   * never touch this format never pay for it.
    */
-  static ElementMaps _element_maps;
+  static ElementMaps & element_maps();
 
   /**
-   * A static function used to construct the _element_maps struct,
-   * statically.
+   * A static function used to construct the element_maps() struct.
    */
   static ElementMaps build_element_maps();
 };
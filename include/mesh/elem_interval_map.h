@@ -0,0 +1,124 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_INTERVAL_MAP_H
+#define LIBMESH_ELEM_INTERVAL_MAP_H
+
+// Local includes
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * A run-length compressed snapshot of per-element processor and
+ * subdomain ids.  After locality-preserving partitioning (e.g. the
+ * Hilbert ordering used by \p SFCPartitioner) both attributes are
+ * constant over long runs of consecutive element ids, so on a large
+ * replicated mesh a few intervals can stand in for billions of
+ * per-element field reads: attribute lookup by element id is a
+ * binary search over runs, and iteration over one processor's
+ * elements becomes a walk of its id intervals rather than a filtered
+ * scan of the whole mesh.
+ *
+ * The snapshot is not kept synchronized with the mesh; rebuild() it
+ * after repartitioning, refinement, or subdomain changes.
+ *
+ * \author Roy H. Stogner
+ * \date 2026
+ * \brief Run-length compressed element processor/subdomain id lookup.
+ */
+class ElemIntervalMap
+{
+public:
+
+  /**
+   * Constructor.  Takes the snapshot immediately.
+   */
+  explicit ElemIntervalMap (const MeshBase & mesh);
+
+  /**
+   * Retakes the snapshot after the mesh's partitioning, refinement,
+   * or subdomain assignment has changed.
+   */
+  void rebuild (const MeshBase & mesh);
+
+  /**
+   * \returns The processor id of element \p elem_id.  The id must
+   * have existed in the mesh when the snapshot was taken.
+   */
+  processor_id_type processor_id (const dof_id_type elem_id) const;
+
+  /**
+   * \returns The subdomain id of element \p elem_id.  The id must
+   * have existed in the mesh when the snapshot was taken.
+   */
+  subdomain_id_type subdomain_id (const dof_id_type elem_id) const;
+
+  /**
+   * \returns The inclusive [first,last] element id intervals owned
+   * by processor \p pid, in ascending order.
+   */
+  std::vector<std::pair<dof_id_type, dof_id_type>>
+  processor_intervals (const processor_id_type pid) const;
+
+  /**
+   * \returns The number of processor id runs; with space-filling-
+   * curve partitioning this stays close to the processor count no
+   * matter how many elements the mesh holds.
+   */
+  std::size_t n_processor_intervals () const
+  { return _pid_run_values.size(); }
+
+  /**
+   * \returns The number of subdomain id runs.
+   */
+  std::size_t n_subdomain_intervals () const
+  { return _sid_run_values.size(); }
+
+private:
+
+  /**
+   * Run starts (sorted element ids) and the attribute value holding
+   * from each start up to the next.  Id gaps within a run, e.g. from
+   * contracted coarsenings, simply extend it.
+   */
+  std::vector<dof_id_type>       _pid_run_starts;
+  std::vector<processor_id_type> _pid_run_values;
+
+  std::vector<dof_id_type>       _sid_run_starts;
+  std::vector<subdomain_id_type> _sid_run_values;
+
+  /**
+   * One past the largest element id covered by the snapshot.
+   */
+  dof_id_type _end_id;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_INTERVAL_MAP_H
@@ -28,6 +28,12 @@
 #include "libmesh/parallel_object.h"
 #include "libmesh/boundary_info.h" // BoundaryInfo::BCTuple
 #include "libmesh/exodus_header_info.h"
+#include "libmesh/mesh_file_metadata.h"
+
+// C++ includes
+#include <map>
+#include <thread>
+#include <utility>
 
 namespace libMesh
 {
@@ -96,6 +102,16 @@ public:
    */
   ExodusHeaderInfo read_header (const std::string & name);
 
+  /**
+   * Reads summary metadata from the file \p name - counts, block and
+   * set ids, and the nodal bounding box - without constructing any
+   * Elem objects or modifying the MeshBase.  Goes a little deeper
+   * than read_header(): the block/sideset/nodeset id arrays and the
+   * nodal coordinates are read (on processor 0, then broadcast), but
+   * no connectivity is.
+   */
+  MeshFileMetadata read_metadata (const std::string & name);
+
   /**
    * This method implements writing a mesh to a specified file.
    */
@@ -138,6 +154,19 @@ public:
                            std::string exodus_var_name,
                            unsigned int timestep=1);
 
+  /**
+   * Reads the nodal values of \p exodus_var_name at \p timestep into
+   * an internal cache on processor 0, so that a subsequent
+   * copy_nodal_solution() call for the same variable and timestep
+   * will not have to touch the file.  When asynchronous mode is
+   * enabled via async(), the read happens on the background thread,
+   * overlapping file access with computation; this is useful when
+   * sweeping through the timesteps of a large transient file.  A
+   * no-op on other processors.
+   */
+  void prefetch_nodal_solution(std::string exodus_var_name,
+                               unsigned int timestep=1);
+
   /**
    * If we read in a elemental solution while reading in a mesh, we can attempt
    * to copy that elemental solution into an EquationSystems object.
@@ -408,6 +437,30 @@ public:
    */
   void append(bool val);
 
+  /**
+   * If true, write_timestep() will return as soon as the solution has
+   * been snapshotted, and will perform the ExodusII library calls on
+   * a background thread, overlapping the file I/O with the next
+   * timestep's assembly and solve.  The snapshot itself (collective
+   * localization of the solution and condensing of the per-variable
+   * nodal vectors) still happens on the calling thread, so no MPI
+   * call is ever made from the background thread.  The pending write
+   * is finished automatically by the next call to write_timestep(),
+   * by wait(), or by the destructor; until then neither the ExodusII
+   * file nor this object should be touched through any other API.
+   * Asynchronous writing currently applies to write_timestep() only;
+   * all other write methods remain synchronous.  Per default, this
+   * mode is off.
+   */
+  void async(bool val);
+
+  /**
+   * Blocks until any write launched by write_timestep() in
+   * asynchronous mode has finished.  A no-op if no write is in
+   * flight.
+   */
+  void wait();
+
   /**
    * Return list of the elemental variable names
    */
@@ -463,6 +516,40 @@ private:
    * rather than created from scratch when writing.
    */
   bool _append;
+
+  /**
+   * Default false.  If true, write_timestep() performs the ExodusII
+   * library calls on a background thread.  See async().
+   */
+  bool _async;
+
+  /**
+   * The background thread which performs the ExodusII calls when
+   * asynchronous mode is enabled.  Only joinable on processor 0
+   * while a write is in flight.
+   */
+  std::thread _async_thread;
+
+  /**
+   * Set while an asynchronous write_timestep() is snapshotting the
+   * solution, telling write_nodal_data() to stage the condensed
+   * per-variable buffers instead of writing them out immediately.
+   */
+  bool _staging_nodal_data;
+
+  /**
+   * The staged (variable index, nodal values) pairs to be written
+   * out by the background thread.
+   */
+  std::vector<std::pair<int, std::vector<Real>>> _staged_nodal_data;
+
+  /**
+   * Nodal variable values read ahead of time by
+   * prefetch_nodal_solution(), keyed on (exodus variable name,
+   * timestep).  Only populated on processor 0.
+   */
+  std::map<std::pair<std::string, unsigned int>,
+           std::map<dof_id_type, Real>> _prefetched_nodal_values;
 #endif
 
   /**
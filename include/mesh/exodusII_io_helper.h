@@ -275,6 +275,17 @@ public:
    */
   void read_nodal_var_values(std::string nodal_var_name, int time_step);
 
+  /**
+   * Reads the nodal values for the variable 'nodal_var_name' at the
+   * specified time for the window of \p count nodes beginning at \p
+   * first_node (in Exodus file ordering), inserting them into
+   * 'nodal_var_values' without clearing any previously read window.
+   * This allows large transient files to be processed in
+   * bounded-memory slices.
+   */
+  void read_nodal_var_values_block(std::string nodal_var_name, int time_step,
+                                   int first_node, int count);
+
   /**
    * Reads elemental values for the variable 'elemental_var_name' at the
    * specified timestep into the 'elem_var_value_map' which is passed in.
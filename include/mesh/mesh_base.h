@@ -51,6 +51,7 @@ namespace libMesh
 // forward declarations
 class Elem;
 class GhostingFunctor;
+class MeshNodeTree;
 class Node;
 class Point;
 class Partitioner;
@@ -153,11 +154,52 @@ public:
   bool is_prepared () const
   { return _is_prepared; }
 
+  /**
+   * Bitmask values naming the phases of prepare_for_use(), used with
+   * the phase-taking set_isnt_prepared() overload to declare which
+   * phases a mesh modification actually dirtied.  \p PREP_TOPOLOGY
+   * (elements added, deleted, or reconnected) invalidates everything
+   * downstream, so it implies the other phases.
+   */
+  enum PreparationPhases : unsigned char
+    {
+      PREP_GEOMETRY     = 0x1,  // node positions moved
+      PREP_IDS          = 0x2,  // node/element ids or id counts changed
+      PREP_PARTITIONING = 0x4,  // processor assignments changed
+      PREP_TOPOLOGY     = 0x8,  // connectivity changed
+      PREP_ALL          = 0xF
+    };
+
   /**
    * Tells this we have done some operation where we should no longer consider ourself prepared
    */
   void set_isnt_prepared()
-  { _is_prepared = false; }
+  { this->set_isnt_prepared(PREP_ALL); }
+
+  /**
+   * As above, but declares exactly which preparation \p phases the
+   * operation dirtied, letting the next prepare_for_use() call skip
+   * the phases whose inputs are unchanged.  For example, an ALE step
+   * which only moved nodes should pass \p PREP_GEOMETRY, after which
+   * prepare_for_use() will skip neighbor finding, renumbering, and
+   * repartitioning.
+   *
+   * The declaration narrows a prepared mesh's pessimistic
+   * assume-everything-dirty default, so it must account for *every*
+   * modification made since the last prepare_for_use(); when in doubt
+   * use the phaseless overload.  Multiple declarations accumulate.
+   */
+  void set_isnt_prepared(unsigned char phases)
+  {
+    // A previously prepared mesh starts a fresh dirty set; further
+    // declarations before the next preparation accumulate.
+    if (_is_prepared)
+      _unprepared_phases = phases;
+    else
+      _unprepared_phases |= phases;
+
+    _is_prepared = false;
+  }
 
   /**
    * \returns \p true if all elements and nodes of the mesh
@@ -398,6 +440,25 @@ public:
    */
   virtual void update_parallel_id_counts () = 0;
 
+  /**
+   * Leases this processor a contiguous block of \p n_elems element
+   * ids and \p n_nodes node ids for elements and nodes it is about to
+   * create locally, e.g. before a batch of refinement.  Subsequent
+   * additions of unnumbered local objects then draw compact ids from
+   * the block with no coordination, rather than from the sparse
+   * interleaved id sequences a DistributedMesh otherwise uses, which
+   * inflate max_elem_id()/max_node_id() by a factor of the processor
+   * count per batch.
+   *
+   * This method is collective when it does anything; mesh
+   * implementations whose id assignment needs no coordination leave
+   * it a no-op.  Over-reservation is safe: unused leased ids are
+   * abandoned at the next update_parallel_id_counts() and compacted
+   * away by the next renumbering.
+   */
+  virtual void reserve_local_ids (dof_id_type /* n_elems */,
+                                  dof_id_type /* n_nodes */) {}
+
   /**
    * \returns The number of active elements in the mesh.
    *
@@ -609,6 +670,13 @@ public:
    */
   virtual void renumber_node (dof_id_type old_id, dof_id_type new_id) = 0;
 
+  /**
+   * Renumbers every node according to \p new_ids, a permutation of
+   * the current contiguous id range mapping each old node id to its
+   * new id.  Used by the bandwidth-reducing renumbering pass.
+   */
+  virtual void renumber_nodes (const std::vector<dof_id_type> & new_ids) = 0;
+
   /**
    * Add elem \p e to the end of the element array.
    * To add an element locally, set e->processor_id() before adding it.
@@ -1052,6 +1120,31 @@ public:
   void allow_renumbering(bool allow) { _skip_renumber_nodes_and_elements = !allow; }
   bool allow_renumbering() const { return !_skip_renumber_nodes_and_elements; }
 
+  /**
+   * If \p true is passed in then prepare_for_use() will follow its
+   * contiguous renumbering with a bandwidth-reducing (reverse
+   * Cuthill-McKee) node renumbering pass on serialized meshes, via
+   * bandwidth_reduce_node_numbering().  Defaults to \p false, since
+   * reordering changes node ids and thus any id-dependent output.
+   */
+  void rcm_node_renumbering(bool rcm) { _rcm_node_renumbering = rcm; }
+  bool rcm_node_renumbering() const { return _rcm_node_renumbering; }
+
+  /**
+   * Renumbers nodes with a reverse Cuthill-McKee ordering of the
+   * nodal adjacency graph (two nodes are adjacent when they share an
+   * element, the same relation that couples their matrix rows), to
+   * reduce the bandwidth of assembled matrices for better ILU fill
+   * and SpMV locality.  Requires a serialized mesh with contiguous
+   * node ids; the ordering between processors is already handled by
+   * the Hilbert-indexed renumbering used during redistribution.
+   *
+   * Keeps the existing numbering if no improvement is found.
+   *
+   * \returns The nodal adjacency bandwidth of the final numbering.
+   */
+  dof_id_type bandwidth_reduce_node_numbering ();
+
   /**
    * If \p false is passed then this mesh will no longer work to find element
    * neighbors when being prepared for use
@@ -1193,6 +1286,15 @@ public:
    */
   std::string get_info () const;
 
+  /**
+   * \returns An estimate, in bytes, of the memory occupied on this
+   * processor by the node and element storage, including any dof
+   * indexing packed onto them.  Caches hanging off the mesh (point
+   * locators, boundary info) are not counted.  This is intended for
+   * instrumentation at phase boundaries, not for exact accounting.
+   */
+  virtual std::size_t memory_footprint () const;
+
   /**
    * Prints relevant information about the mesh.
    */
@@ -1311,6 +1413,94 @@ public:
    */
   bool get_count_lower_dim_elems_in_point_locator() const;
 
+  /**
+   * Compressed-row adjacency of the mesh's nodes.  Row \p r holds the
+   * data for node id \p node_ids[r]: its edge-connected neighbor node
+   * ids in \p neighbor_nodes[node_offsets[r], node_offsets[r+1]) and
+   * the ids of the active elements containing it in \p
+   * elem_ids[elem_offsets[r], elem_offsets[r+1]).  The contiguous
+   * arrays here make nodal sweeps (gradient limiters, monotonicity
+   * fixes, etc.) linear scans, where repeatedly chasing \p Elem node
+   * pointers or a map-of-vectors from \p
+   * MeshTools::build_nodes_to_elem_map() would thrash the cache.
+   */
+  struct NodeAdjacency
+  {
+    /**
+     * The ids of the nodes with adjacency rows, in ascending order.
+     * On a distributed mesh only the nodes of local and ghosted
+     * elements appear.
+     */
+    std::vector<dof_id_type> node_ids;
+
+    /**
+     * Row offsets into \p neighbor_nodes; sized \p node_ids.size()+1.
+     */
+    std::vector<std::size_t> node_offsets;
+
+    /**
+     * Concatenated neighbor node ids, each row in ascending order.
+     * Two nodes are neighbors if they share an edge of an active
+     * element; nodes of edgeless (0D and 1D) elements are all
+     * mutually adjacent.
+     */
+    std::vector<dof_id_type> neighbor_nodes;
+
+    /**
+     * Row offsets into \p elem_ids; sized \p node_ids.size()+1.
+     */
+    std::vector<std::size_t> elem_offsets;
+
+    /**
+     * Concatenated ids of the active elements containing each node.
+     */
+    std::vector<dof_id_type> elem_ids;
+
+    /**
+     * \returns The row index for node id \p node, found by binary
+     * search.  The node must have an adjacency row.
+     */
+    std::size_t row (dof_id_type node) const;
+  };
+
+  /**
+   * \returns The nodal adjacency graph for the mesh's current
+   * elements, building and caching it on first access.  The cache is
+   * invalidated whenever the underlying elements change, at the same
+   * time as the \p PointLocator.
+   */
+  const NodeAdjacency & node_adjacency () const;
+
+  /**
+   * \returns The active local elements grouped into "colors" such
+   * that no two elements within one color share a node, built by
+   * greedy coloring over the nodal adjacency graph and cached.  Since
+   * two elements which share no node also share no degree of freedom
+   * under a standard dof distribution, each color's elements can
+   * assemble into a shared matrix concurrently without conflicting on
+   * any row.  The cache is invalidated whenever the underlying
+   * elements change, at the same time as the \p PointLocator, so
+   * adaptive refinement simply triggers a recolor on next use.
+   */
+  const std::vector<std::vector<const Elem *>> & element_colors () const;
+
+  /**
+   * \returns A KD-tree over the positions of the mesh's stored nodes
+   * for nearest-node and radius queries, building and caching it on
+   * first access.  The cache is invalidated whenever the underlying
+   * mesh changes, at the same time as the \p PointLocator; as with
+   * the \p PointLocator, users moving nodes by hand must call \p
+   * clear_point_locator() themselves before querying again.
+   */
+  const MeshNodeTree & node_tree () const;
+
+  /**
+   * \returns A counter which is incremented every time the mesh's
+   * elements may have changed, so caches of element-derived data can
+   * be generation-stamped and cheaply checked for staleness.
+   */
+  unsigned long generation () const { return _generation; }
+
   /**
    * Verify id and processor_id consistency of our elements and
    * nodes containers.
@@ -1499,6 +1689,20 @@ public:
   virtual const_element_iterator active_type_elements_begin (ElemType type) const = 0;
   virtual const_element_iterator active_type_elements_end (ElemType type) const = 0;
 
+  /**
+   * Iterate over the active local elements of a single geometric
+   * type.  Together with MeshTools::elem_types(), these ranges let
+   * assembly and error estimation loops process one homogeneous
+   * element type at a time, hoisting per-type FE setup out of the
+   * inner loop.
+   */
+  virtual element_iterator active_local_type_elements_begin (ElemType type) = 0;
+  virtual element_iterator active_local_type_elements_end (ElemType type) = 0;
+  virtual const_element_iterator active_local_type_elements_begin (ElemType type) const = 0;
+  virtual const_element_iterator active_local_type_elements_end (ElemType type) const = 0;
+  virtual SimpleRange<element_iterator> active_local_type_elements_ptr_range(ElemType type) = 0;
+  virtual SimpleRange<const_element_iterator> active_local_type_elements_ptr_range(ElemType type) const = 0;
+
   virtual element_iterator active_pid_elements_begin (processor_id_type proc_id) = 0;
   virtual element_iterator active_pid_elements_end (processor_id_type proc_id) = 0;
   virtual const_element_iterator active_pid_elements_begin (processor_id_type proc_id) const = 0;
@@ -1733,6 +1937,14 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * The preparation phases dirtied since the last prepare_for_use(),
+   * as a bitmask of PreparationPhases.  Reset to \p PREP_ALL after
+   * each preparation, so untracked modifications still get the full
+   * pipeline; callers narrow it via set_isnt_prepared(phases).
+   */
+  unsigned char _unprepared_phases;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -1742,6 +1954,34 @@ protected:
    */
   mutable std::unique_ptr<PointLocatorBase> _point_locator;
 
+  /**
+   * The cached nodal adjacency graph, built on demand by \p
+   * node_adjacency() and discarded alongside the \p PointLocator
+   * whenever the underlying elements change.
+   */
+  mutable std::unique_ptr<NodeAdjacency> _node_adjacency;
+
+  /**
+   * The cached KD-tree over our nodes, built on demand by \p
+   * node_tree() and discarded alongside the \p PointLocator whenever
+   * the underlying mesh changes.
+   */
+  mutable std::unique_ptr<MeshNodeTree> _node_tree;
+
+  /**
+   * The cached element coloring, built on demand by \p
+   * element_colors() and discarded alongside the \p PointLocator
+   * whenever the underlying elements change.
+   */
+  mutable std::vector<std::vector<const Elem *>> _element_colors;
+
+  /**
+   * The generation stamp returned by \p generation(), incremented
+   * alongside every \p clear_point_locator() call, which every
+   * element-mutating path already makes.
+   */
+  unsigned long _generation;
+
   /**
    * Do we count lower dimensional elements in point locator refinement?
    * This is relevant in tree-based point locators, for example.
@@ -1786,6 +2026,13 @@ protected:
    */
   bool _skip_find_neighbors;
 
+  /**
+   * If this is \p true then prepare_for_use() runs the
+   * bandwidth-reducing node renumbering pass after its contiguous
+   * renumbering.
+   */
+  bool _rcm_node_renumbering;
+
   /**
    * If this is false then even on DistributedMesh remote elements
    * will not be deleted during mesh preparation.
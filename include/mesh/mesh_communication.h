@@ -26,6 +26,7 @@
 #include "libmesh/mesh_tools.h"
 
 // C++ Includes
+#include <set>
 #include <unordered_map>
 
 namespace libMesh
@@ -106,6 +107,20 @@ public:
    */
   void gather_neighboring_elements (DistributedMesh &) const;
 
+  /**
+   * Each processor requests copies of the elements whose ids are in
+   * \p requested_ids but which are not present locally, and their
+   * owners reply with the elements, their family trees, and their
+   * nodes.  This allows ghost elements outside the halos selected by
+   * the mesh's GhostingFunctors to be materialized on demand rather
+   * than eagerly, e.g. for wide stencils which are only partially
+   * touched.  Since this method is collective it must be called by
+   * all processors, but the requested id sets may differ (and be
+   * empty) from processor to processor.
+   */
+  void gather_elements_by_id (DistributedMesh & mesh,
+                              const std::set<dof_id_type> & requested_ids) const;
+
   /**
    * Examine a just-coarsened mesh, and for any newly-coarsened elements,
    * send the associated ghosted elements to the processor which needs them.
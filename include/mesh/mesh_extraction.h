@@ -0,0 +1,117 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MESH_EXTRACTION_H
+#define LIBMESH_MESH_EXTRACTION_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h" // for subdomain_id_type
+
+// C++ Includes
+#include <functional>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class MeshBase;
+class Node;
+class Point;
+class UnstructuredMesh;
+
+
+// ------------------------------------------------------------
+// MeshTools::Extraction namespace
+namespace MeshTools
+{
+/**
+ * Tools for extracting reduced visualization surfaces - planar slices
+ * and isosurfaces - from 3D meshes, e.g. to write in situ instead of
+ * full volume data.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ */
+namespace Extraction
+{
+/**
+ * Appends to \p surface a triangulated approximation of the zero
+ * level set of \p level_set within \p mesh, computed by marching
+ * over a tetrahedral decomposition of every active 3D element.  The
+ * level set is sampled at element vertices only, so the extract is
+ * exact for fields linear over each subtetrahedron and approximate
+ * otherwise.  New elements are assigned subdomain id \p sbd_id, so
+ * multiple extracts appended to one surface remain distinguishable.
+ *
+ * If \p surface_soln is non-null then \p mesh_soln must point to a
+ * node-major nodal solution vector on \p mesh holding \p n_vars
+ * values per node, as built by
+ * EquationSystems::build_solution_vector(); the values are
+ * interpolated onto the new surface nodes, indexed by surface node
+ * id in the same node-major layout.
+ *
+ * The element sweep is threaded.  \p mesh must be serialized, and
+ * every processor builds the full (replicated) surface.
+ */
+void build_level_set_surface (const MeshBase & mesh,
+                              const std::function<Real(const Node &)> & level_set,
+                              UnstructuredMesh & surface,
+                              const subdomain_id_type sbd_id = 0,
+                              const std::vector<Number> * mesh_soln = nullptr,
+                              const unsigned int n_vars = 0,
+                              std::vector<Number> * surface_soln = nullptr);
+
+/**
+ * Appends to \p surface the intersection of \p mesh with the plane
+ * through \p point with normal \p normal, interpolating nodal data
+ * as described for build_level_set_surface().
+ */
+void build_slice (const MeshBase & mesh,
+                  const Point & point,
+                  const Point & normal,
+                  UnstructuredMesh & surface,
+                  const subdomain_id_type sbd_id = 0,
+                  const std::vector<Number> * mesh_soln = nullptr,
+                  const unsigned int n_vars = 0,
+                  std::vector<Number> * surface_soln = nullptr);
+
+/**
+ * Appends to \p surface the isosurface on which variable \p var of
+ * the node-major solution vector \p mesh_soln takes the value \p
+ * iso_value, interpolating nodal data as described for
+ * build_level_set_surface().  For complex-valued builds the real
+ * part of the variable is contoured.
+ */
+void build_isosurface (const MeshBase & mesh,
+                       const std::vector<Number> & mesh_soln,
+                       const unsigned int n_vars,
+                       const unsigned int var,
+                       const Real iso_value,
+                       UnstructuredMesh & surface,
+                       const subdomain_id_type sbd_id = 0,
+                       std::vector<Number> * surface_soln = nullptr);
+
+} // namespace Extraction
+} // namespace MeshTools
+
+} // namespace libMesh
+
+#endif // LIBMESH_MESH_EXTRACTION_H
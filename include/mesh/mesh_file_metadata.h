@@ -0,0 +1,147 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_MESH_FILE_METADATA_H
+#define LIBMESH_MESH_FILE_METADATA_H
+
+// Local includes
+#include "libmesh/bounding_box.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+
+// TIMPI includes
+#include "timpi/communicator.h"
+#include "timpi/parallel_implementation.h"
+
+// C++ includes
+#include <set>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * \brief Summary information about an on-disk mesh, readable without
+ * constructing any Node or Elem objects.
+ *
+ * Filled in by the metadata-only readers (NameBasedIO::read_metadata()
+ * and the per-format implementations behind it) for tooling that only
+ * wants to report counts, id sets, and extents - pre-flight
+ * validation, meshtool-style inspection, etc.  Not every format
+ * records every field in its header; the \p have_* flags say which
+ * fields the reader was able to supply authoritatively.
+ *
+ * \author Roy H. Stogner
+ * \date 2026
+ */
+class MeshFileMetadata
+{
+public:
+  // All special functions can be defaulted for this simple class.
+  MeshFileMetadata () = default;
+  MeshFileMetadata (MeshFileMetadata &&) = default;
+  MeshFileMetadata (const MeshFileMetadata &) = default;
+  MeshFileMetadata & operator= (const MeshFileMetadata &) = default;
+  MeshFileMetadata & operator= (MeshFileMetadata &&) = default;
+  ~MeshFileMetadata() = default;
+
+  /**
+   * Broadcasts data from processor 0 to other procs using the
+   * provided Communicator.
+   */
+  void broadcast(const Parallel::Communicator & comm)
+  {
+    std::vector<largest_id_type> scalars =
+      { n_nodes, n_elem, mesh_dimension,
+        have_counts, have_bounding_box,
+        have_subdomain_ids, have_boundary_ids };
+    comm.broadcast(scalars);
+
+    n_nodes           = cast_int<dof_id_type>(scalars[0]);
+    n_elem            = cast_int<dof_id_type>(scalars[1]);
+    mesh_dimension    = cast_int<unsigned int>(scalars[2]);
+    have_counts       = scalars[3];
+    have_bounding_box = scalars[4];
+    have_subdomain_ids = scalars[5];
+    have_boundary_ids  = scalars[6];
+
+    std::vector<Real> box =
+      { bounding_box.min()(0), bounding_box.min()(1), bounding_box.min()(2),
+        bounding_box.max()(0), bounding_box.max()(1), bounding_box.max()(2) };
+    comm.broadcast(box);
+    bounding_box.min() = Point(box[0], box[1], box[2]);
+    bounding_box.max() = Point(box[3], box[4], box[5]);
+
+    // broadcast the id sets through vectors; we don't require
+    // container support for std::set from the communicator here
+    std::vector<subdomain_id_type>
+      sbd_ids (subdomain_ids.begin(), subdomain_ids.end());
+    comm.broadcast(sbd_ids);
+    subdomain_ids.clear();
+    subdomain_ids.insert(sbd_ids.begin(), sbd_ids.end());
+
+    std::vector<boundary_id_type>
+      side_ids (side_boundary_ids.begin(), side_boundary_ids.end());
+    comm.broadcast(side_ids);
+    side_boundary_ids.clear();
+    side_boundary_ids.insert(side_ids.begin(), side_ids.end());
+
+    std::vector<boundary_id_type>
+      node_ids (node_boundary_ids.begin(), node_boundary_ids.end());
+    comm.broadcast(node_ids);
+    node_boundary_ids.clear();
+    node_boundary_ids.insert(node_ids.begin(), node_ids.end());
+  }
+
+  /**
+   * Global node and element counts; meaningful iff \p have_counts.
+   */
+  dof_id_type n_nodes = 0;
+  dof_id_type n_elem = 0;
+  bool have_counts = false;
+
+  /**
+   * The spatial dimension recorded in the file, or 0 if the format's
+   * header doesn't record one.
+   */
+  unsigned int mesh_dimension = 0;
+
+  /**
+   * Bounding box of the nodal coordinates; meaningful iff \p
+   * have_bounding_box.
+   */
+  BoundingBox bounding_box;
+  bool have_bounding_box = false;
+
+  /**
+   * Subdomain ids and side/node boundary ids found in the file.  The
+   * corresponding \p have_* flag is \p true when the format records
+   * the complete set; formats which only store *named* ids in their
+   * headers (e.g. Checkpoint) fill in what they know and leave the
+   * flag \p false.
+   */
+  std::set<subdomain_id_type> subdomain_ids;
+  bool have_subdomain_ids = false;
+
+  std::set<boundary_id_type> side_boundary_ids;
+  std::set<boundary_id_type> node_boundary_ids;
+  bool have_boundary_ids = false;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MESH_FILE_METADATA_H
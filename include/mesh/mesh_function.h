@@ -192,6 +192,45 @@ public:
                    DenseVector<Number> & output,
                    const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Batch evaluation: computes all variables at each coordinate in
+   * \p points and for time \p time, optionally restricting the points
+   * to the passed subdomain_ids.  The points are first grouped by
+   * containing element, so each element's inverse mapping and dof
+   * index gathering happen once per element instead of once per
+   * point.  Coupling codes evaluating many points per transfer should
+   * prefer this to calling \p operator() in a loop.
+   *
+   * \p values is resized to \p points.size() times the number of
+   * variables, with the values for point \p i stored contiguously
+   * starting at \p values[i * n_vars].  Points not contained in any
+   * element get the out-of-mesh value, which must have been enabled.
+   */
+  void evaluate (const std::vector<Point> & points,
+                 std::vector<Number> & values,
+                 const Real time = 0.,
+                 const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
+  /**
+   * Collective batch evaluation: like \p evaluate(), but each
+   * processor may pass its own (possibly empty) list of query points,
+   * which need not be evaluable locally.  Points that miss the local
+   * elements are batched, routed to the processors whose local
+   * bounding boxes contain them, evaluated there, and the results
+   * returned to the requesting processor.  The attached solution
+   * vector therefore only needs its usual ghosted coverage - no
+   * serialization or global localization is required, so sampling
+   * lines or planes through a DistributedMesh scales.
+   *
+   * Points not found on any processor evaluate to the out-of-mesh
+   * value, which must have been enabled; otherwise they are an error.
+   * This function must be run on all processors at once.
+   */
+  void distributed_evaluate (const std::vector<Point> & points,
+                             std::vector<Number> & values,
+                             const Real time = 0.,
+                             const std::set<subdomain_id_type> * subdomain_ids = nullptr);
+
   /**
    * Similar to operator() with the same parameter list, but with the difference
    * that multiple values on faces are explicitly permitted. This is useful for
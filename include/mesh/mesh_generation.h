@@ -38,6 +38,7 @@ namespace libMesh
 // forward declarations
 class MeshBase;
 class UnstructuredMesh;
+class DistributedMesh;
 class Elem;
 
 
@@ -76,6 +77,34 @@ void build_cube (UnstructuredMesh & mesh,
                  const ElemType type=INVALID_ELEM,
                  const bool gauss_lobatto_grid=false);
 
+/**
+ * Builds the same \f$ nx \times ny \times nz \f$ (elements) cube as
+ * \p build_cube(), but distributed-from-birth: each processor
+ * constructs only its own contiguous slab of element layers (plus a
+ * one-layer ghost halo) directly into the DistributedMesh, so
+ * construction time and peak memory scale as O(N/P) rather than O(N).
+ *
+ * Element ids, node ids, and boundary ids match those assigned by \p
+ * build_cube(), so the result is equivalent to building the cube
+ * serially and then partitioning it into slabs along the
+ * highest-numbered dimension.  The mesh's partitioner is cleared so
+ * that \p prepare_for_use() preserves that decomposition; users who
+ * want a different partitioning can reinstall a partitioner and
+ * repartition afterward.
+ *
+ * Only the linear types (EDGE2, QUAD4, HEX8) take the distributed
+ * fast path; other element types fall back to \p build_cube().
+ */
+void build_distributed_cube (DistributedMesh & mesh,
+                             const unsigned int nx=0,
+                             const unsigned int ny=0,
+                             const unsigned int nz=0,
+                             const Real xmin=0., const Real xmax=1.,
+                             const Real ymin=0., const Real ymax=1.,
+                             const Real zmin=0., const Real zmax=1.,
+                             const ElemType type=INVALID_ELEM,
+                             const bool gauss_lobatto_grid=false);
+
 /**
  * A specialized \p build_cube() for 0D meshes.  The resulting
  * mesh is a single NodeElem suitable for ODE tests
@@ -24,6 +24,9 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/id_types.h" // for boundary_id_type, subdomain_id_type
 
+// C++ Includes
+#include <string>
+
 namespace libMesh
 {
 
@@ -143,6 +146,25 @@ void smooth(MeshBase &, unsigned int, Real);
 void flatten(MeshBase & mesh);
 #endif // #ifdef LIBMESH_ENABLE_AMR
 
+/**
+ * Reorders the elements (and, through their first-touch order, the
+ * nodes) of \p mesh along a space-filling curve, so that elements
+ * which are close in space are also close in memory and in id.
+ * Assembly and error estimation loops over the reordered mesh then
+ * touch solution and mesh storage nearly sequentially, which can
+ * substantially reduce cache misses on large meshes.  Valid choices
+ * for \p sfc_type are "Hilbert" (default) and "Morton", as with the
+ * \p SFCPartitioner.
+ *
+ * Element and node ids are renumbered, so this should be called
+ * before any \p EquationSystems initialization.  Requires the
+ * sfcurves library; without it the mesh is left unchanged.
+ *
+ * \note Only serial, unrefined meshes are currently supported.
+ */
+void sfc_reorder (MeshBase & mesh,
+                  const std::string & sfc_type = "Hilbert");
+
 /**
  * Finds any boundary ids that are currently old_id,
  * changes them to new_id
@@ -0,0 +1,186 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MESH_NODE_TREE_H
+#define LIBMESH_MESH_NODE_TREE_H
+
+// Local includes
+#include "libmesh/libmesh_config.h"
+#include "libmesh/libmesh_common.h"
+#include "libmesh/node.h"
+#ifdef LIBMESH_HAVE_NANOFLANN
+#  include "libmesh/ignore_warnings.h"
+#  include "libmesh/nanoflann.hpp"
+#  include "libmesh/restore_warnings.h"
+#endif
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * A persistent KD-tree over the positions of a mesh's stored nodes,
+ * supporting nearest-node and fixed-radius queries in logarithmic
+ * time where ad-hoc callers previously scanned every node.  The tree
+ * indexes whatever nodes the mesh holds, so on a distributed mesh
+ * queries see local and ghosted nodes only, and query results are
+ * purely local, not collective.
+ *
+ * Instances are normally obtained from \p MeshBase::node_tree(),
+ * which caches one per mesh and discards it whenever the mesh
+ * changes, at the same time as the \p PointLocator; like the
+ * \p PointLocator, a stale tree after moving nodes by hand must be
+ * flushed with \p MeshBase::clear_point_locator().
+ *
+ * When the library is built without nanoflann the same interface
+ * remains available, falling back on a linear scan of the node list.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief KD-tree for nearest-node and radius queries on a mesh.
+ */
+class MeshNodeTree
+{
+public:
+
+  /**
+   * Constructor.  Takes the mesh whose nodes we index; \p init()
+   * must be called before querying.
+   */
+  explicit MeshNodeTree (const MeshBase & mesh);
+
+  /**
+   * Destructor.
+   */
+  ~MeshNodeTree ();
+
+  /**
+   * Snapshots the mesh's current node positions and builds the
+   * KD-tree index over them.
+   */
+  void init ();
+
+  /**
+   * \returns \p true if \p init() has been called.
+   */
+  bool initialized () const { return _initialized; }
+
+  /**
+   * \returns The stored node closest to \p p, or \p nullptr if the
+   * mesh stores no nodes.  If \p dist_sq is non-null it is set to the
+   * squared distance from \p p to the returned node.
+   */
+  const Node * nearest_node (const Point & p,
+                             Real * dist_sq = nullptr) const;
+
+  /**
+   * Fills \p nodes with every stored node strictly closer to \p p
+   * than \p radius, ordered nearest-first.
+   */
+  void nodes_in_radius (const Point & p,
+                        Real radius,
+                        std::vector<const Node *> & nodes) const;
+
+private:
+
+#ifdef LIBMESH_HAVE_NANOFLANN
+  /**
+   * This class adapts our vector of Node pointers for use in a
+   * nanoflann KD-Tree, following the PointListAdaptor pattern in
+   * meshfree_interpolation.h.  We always adapt all three coordinates;
+   * unused ones are simply zero.
+   */
+  class NodeListAdaptor
+  {
+  private:
+    const std::vector<const Node *> & _nodes;
+
+  public:
+    NodeListAdaptor (const std::vector<const Node *> & nodes) :
+      _nodes(nodes)
+    {}
+
+    /**
+     * Must return the number of data points
+     */
+    inline size_t kdtree_get_point_count() const { return _nodes.size(); }
+
+    /**
+     * \returns The dim'th component of the idx'th point in the class:
+     * Since this is inlined and the "dim" argument is typically an immediate value, the
+     *  "if's" are actually solved at compile time.
+     */
+    inline Real kdtree_get_pt(const size_t idx, int dim) const
+    {
+      libmesh_assert_less (idx, _nodes.size());
+      libmesh_assert_less (dim, 3);
+
+      const Point & p(*_nodes[idx]);
+
+      if (dim==0) return p(0);
+      if (dim==1) return p(1);
+      return p(2);
+    }
+
+    /**
+     * Optional bounding-box computation
+     */
+    template <class BBOX>
+    bool kdtree_get_bbox(BBOX & /* bb */) const { return false; }
+  };
+
+  typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<Real, NodeListAdaptor>,
+                                              NodeListAdaptor, 3> kd_tree_t;
+#endif // LIBMESH_HAVE_NANOFLANN
+
+  /**
+   * The mesh whose nodes we index.
+   */
+  const MeshBase & _mesh;
+
+  /**
+   * The indexed nodes, in iteration order at \p init() time.
+   */
+  std::vector<const Node *> _nodes;
+
+  /**
+   * \p true if \p init() has been called.
+   */
+  bool _initialized;
+
+#ifdef LIBMESH_HAVE_NANOFLANN
+  /**
+   * The adaptor wrapping \p _nodes and the KD-tree built over it.
+   */
+  NodeListAdaptor _adaptor;
+
+  std::unique_ptr<kd_tree_t> _kd_tree;
+#endif
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MESH_NODE_TREE_H
@@ -26,11 +26,14 @@
 #include "libmesh/libmesh_logging.h"
 #include "libmesh/mesh_base.h"
 #include "libmesh/mesh_serializer.h"
+#include "libmesh/point.h"
 
 // C++ includes
 #include <cstddef>
+#include <functional>
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -146,6 +149,29 @@ public:
                                  const EquationSystems &,
                                  const std::set<std::string> *);
 
+  /**
+   * Registers an in-situ slice extract: the intersection of the mesh
+   * with the plane through \p point with normal \p normal.  Once any
+   * extract is registered, write_equation_systems() no longer writes
+   * the full volume mesh; it writes only the extracted surfaces, with
+   * nodal data interpolated onto them, cutting output volume by
+   * orders of magnitude for every-step output.
+   */
+  void add_slice_extract (const Point & point, const Point & normal);
+
+  /**
+   * Registers an in-situ isosurface extract: the surface on which the
+   * variable named \p var_name takes the value \p iso_value.  See
+   * add_slice_extract() for how registered extracts change
+   * write_equation_systems().
+   */
+  void add_isosurface_extract (const std::string & var_name, Real iso_value);
+
+  /**
+   * Removes all registered extracts, restoring full volume output.
+   */
+  void clear_extracts ();
+
   /**
    * Return/set the precision to use when writing ASCII files.
    *
@@ -163,6 +189,31 @@ protected:
    */
   const MT & mesh() const;
 
+  /**
+   * Writes a single file by compositing per-processor pieces on
+   * processor 0, as an alternative to serializing the whole mesh
+   * there first.
+   *
+   * Each entry of \p sections is invoked on every processor to format
+   * that processor's contribution to one section of the file; within
+   * each section the formatted pieces are appended to \p fname in
+   * rank order, using a token protocol so that processor 0 holds at
+   * most one remote processor's piece in memory at a time.  \p header
+   * and \p footer, if provided, are invoked on processor 0 only,
+   * before the first section and after the last.
+   *
+   * Rank-order concatenation matches id order whenever object ids are
+   * numbered contiguously by processor, as
+   * DistributedMesh::renumber_nodes_and_elements() arranges; callers
+   * formatting id-ordered sections should renumber first.
+   *
+   * This must be called on all processors at once.
+   */
+  void composite_write (const std::string & fname,
+                        const std::function<void(std::ostream &)> & header,
+                        const std::vector<std::function<void(std::ostream &)>> & sections,
+                        const std::function<void(std::ostream &)> & footer) const;
+
 
   /**
    * Flag specifying whether this format is parallel-capable.
@@ -182,6 +233,16 @@ protected:
 
 private:
 
+  /**
+   * Computes all registered extracts from the node-major solution
+   * vector \p soln and writes the combined surface mesh, with its
+   * interpolated data, to \p fname via NameBasedIO.  Each extract's
+   * triangles get a distinct subdomain id, in registration order
+   * with slices first.
+   */
+  void write_extracts (const std::string & fname,
+                       const std::vector<Number> & soln,
+                       const std::vector<std::string> & names);
 
   /**
    *  A pointer to a constant object.
@@ -193,6 +254,16 @@ private:
    * Precision to use when writing ASCII files.
    */
   unsigned int _ascii_precision;
+
+  /**
+   * Registered slice extracts, as (point, normal) pairs.
+   */
+  std::vector<std::pair<Point, Point>> _slice_extracts;
+
+  /**
+   * Registered isosurface extracts, as (variable name, value) pairs.
+   */
+  std::vector<std::pair<std::string, Real>> _isosurface_extracts;
 };
 
 
@@ -260,6 +331,36 @@ unsigned int & MeshOutput<MT>::ascii_precision ()
 }
 
 
+
+template <class MT>
+inline
+void MeshOutput<MT>::add_slice_extract (const Point & point,
+                                        const Point & normal)
+{
+  _slice_extracts.emplace_back(point, normal);
+}
+
+
+
+template <class MT>
+inline
+void MeshOutput<MT>::add_isosurface_extract (const std::string & var_name,
+                                             Real iso_value)
+{
+  _isosurface_extracts.emplace_back(var_name, iso_value);
+}
+
+
+
+template <class MT>
+inline
+void MeshOutput<MT>::clear_extracts ()
+{
+  _slice_extracts.clear();
+  _isosurface_extracts.clear();
+}
+
+
 } // namespace libMesh
 
 
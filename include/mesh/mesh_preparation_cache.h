@@ -0,0 +1,80 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MESH_PREPARATION_CACHE_H
+#define LIBMESH_MESH_PREPARATION_CACHE_H
+
+// C++ includes
+#include <cstdint>
+#include <string>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * Saves and replays the derived products of mesh preparation, for
+ * workflows which run the same mesh many times.  After the first
+ * prepare_for_use() has paid for neighbor finding and partitioning,
+ * write() serializes the neighbor links and the processor/subdomain
+ * assignment keyed by a hash of the mesh content; later runs call
+ * try_adopt() on the unprepared mesh, which validates the hash and, on
+ * a match, installs the cached products and finishes preparation with
+ * those phases skipped.
+ *
+ * \author Roy H. Stogner
+ * \date 2026
+ * \brief Replays cached mesh preparation products across runs.
+ */
+class MeshPreparationCache
+{
+public:
+
+  /**
+   * \returns A hash of the mesh content - node positions and element
+   * connectivity - used to decide whether a cache file still matches
+   * the mesh it was written from.
+   */
+  static std::uint64_t content_hash (const MeshBase & mesh);
+
+  /**
+   * Writes the preparation products of the (prepared, serial) \p mesh
+   * to \p name, keyed by its content hash.
+   */
+  static void write (const MeshBase & mesh,
+                     const std::string & name);
+
+  /**
+   * Attempts to adopt the cached preparation products in \p name for
+   * the (unprepared, serial) \p mesh.  If the file is missing or was
+   * written from different mesh content this is a no-op returning
+   * \p false; otherwise the cached neighbor links and processor and
+   * subdomain assignments are installed, prepare_for_use() is run
+   * with neighbor finding and partitioning skipped, and \p true is
+   * returned.
+   */
+  static bool try_adopt (MeshBase & mesh,
+                         const std::string & name);
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MESH_PREPARATION_CACHE_H
@@ -0,0 +1,141 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_MESH_QUALITY_MONITOR_H
+#define LIBMESH_MESH_QUALITY_MONITOR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_quality.h"
+#include "libmesh/error_vector.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+class Elem;
+
+/**
+ * The MeshQualityMonitor class computes a per-element quality metric
+ * for a whole mesh at once, threading the Elem::quality() sweep and
+ * caching the result so that repeated evaluations (e.g. a quality
+ * gate run every step of an ALE computation) only recompute elements
+ * whose geometry has actually moved.  Distributed reductions over the
+ * cached values are provided for the quantities such a gate needs:
+ * the global minimum and a global histogram.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief Threaded, incrementally-updated mesh-wide element quality.
+ */
+class MeshQualityMonitor : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  Takes a reference to the mesh to be monitored and
+   * the quality metric to compute.
+   */
+  MeshQualityMonitor (const MeshBase & mesh,
+                      ElemQuality metric);
+
+  /**
+   * Marks a single element's cached quality as stale, e.g. after its
+   * nodes have been moved.
+   */
+  void mark_moved (const Elem & elem);
+
+  /**
+   * Marks every cached quality as stale.  This is also the state a
+   * freshly constructed monitor starts in.
+   */
+  void mark_all_moved ();
+
+  /**
+   * Recomputes the quality of every stale active local element, in
+   * threads, and \returns the cached per-element quality vector.  The
+   * vector follows the ErrorVector convention: it is indexed by
+   * element id, and entries for inactive or non-local elements are
+   * zero.
+   */
+  const ErrorVector & compute ();
+
+  /**
+   * \returns The minimum cached quality over every active element of
+   * the mesh, reduced across all processors.  compute() must be
+   * called first (and again after any mark_moved() calls).
+   */
+  Real global_minimum () const;
+
+  /**
+   * Bins the cached quality of every active element of the mesh into
+   * \p n_bins equal-width bins between the global minimum and
+   * maximum, reduced across all processors.  On exit \p bin_members
+   * holds the global element count per bin and [\p min, \p max] the
+   * global range.  compute() must be called first.
+   */
+  void global_histogram (std::vector<dof_id_type> & bin_members,
+                         unsigned int n_bins,
+                         Real & min,
+                         Real & max) const;
+
+  /**
+   * \returns The metric this monitor computes.
+   */
+  ElemQuality metric () const { return _metric; }
+
+private:
+
+  /**
+   * The mesh being monitored.
+   */
+  const MeshBase & _mesh;
+
+  /**
+   * The quality metric to compute.
+   */
+  const ElemQuality _metric;
+
+  /**
+   * Cached per-element quality, indexed by element id.
+   */
+  ErrorVector _quality;
+
+  /**
+   * Per-element geometry dirty flags, indexed by element id.
+   */
+  std::vector<bool> _moved;
+
+  /**
+   * Set when every element needs recomputation, so we can skip the
+   * per-element flag bookkeeping on the first sweep and after
+   * mark_all_moved().
+   */
+  bool _all_moved;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_MESH_QUALITY_MONITOR_H
@@ -29,10 +29,12 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
+#include "libmesh/bounding_box.h"
 #include "libmesh/topology_map.h"
 #include "libmesh/parallel_object.h"
 
 // C++ Includes
+#include <map>
 #include <vector>
 
 namespace libMesh
@@ -180,6 +182,25 @@ public:
                                        const Real coarsen_fraction = 0.0,
                                        const unsigned int max_level = libMesh::invalid_uint);
 
+  /**
+   * Flags elements for coarsening and refinement based on
+   * the computed error passed in \p error_per_cell, picking the same
+   * top \p refine_fraction() * \p n_elem and bottom \p
+   * coarsen_fraction() * \p n_elem elements as \p
+   * flag_elements_by_elem_fraction() would.
+   *
+   * Unlike \p flag_elements_by_elem_fraction(), this method never
+   * gathers every processor's error values onto every other
+   * processor; the global cutoff errors are instead found by a
+   * parallel selection over each processor's local values, using
+   * repeated distributed histograms.  On large distributed meshes
+   * this avoids both the allgather and the global sort.
+   *
+   * This method is controlled entirely by the corresponding member
+   * parameters; it takes no deprecated function arguments.
+   */
+  void flag_elements_by_elem_fraction_distributed (const ErrorVector & error_per_cell);
+
   /**
    * Flags elements for coarsening and refinement based on
    * the computed error passed in \p error_per_cell.  This method picks
@@ -267,6 +288,49 @@ public:
    */
   void uniformly_coarsen (unsigned int n=1);
 
+  /**
+   * Fills \p level_sets with the per-level active element sets of
+   * the current refinement hierarchy: \p level_sets[l] holds the
+   * elements making up the level-\p l grid, i.e. the elements of
+   * refinement level \p l which are active or have been refined,
+   * plus any coarser active elements.  The last set is the active
+   * element set of the mesh.  Geometric multigrid setups use these
+   * sets to visit each grid of the hierarchy without re-coarsening
+   * the mesh.
+   */
+  void build_level_hierarchy (std::vector<std::vector<const Elem *>> & level_sets) const;
+
+  /**
+   * Coarsens whole refinement subtrees in a single pass.
+   * \p subtree_target_levels maps the id of a level-0 element to the
+   * level its subtree should be collapsed to; subtrees whose level-0
+   * ancestor does not appear in the map are left alone.  Every
+   * descendant above a subtree's target level is deleted outright,
+   * the ancestors at the target level become the new active elements,
+   * and all neighbor, boundary, and numbering fix-up is deferred to a
+   * single MeshBase::prepare_for_use() call, avoiding the per-level
+   * flag smoothing and re-validation sweeps that repeated
+   * coarsen_elements() calls perform.
+   *
+   * Unlike coarsen_elements(), the deleted elements are removed
+   * immediately rather than left for contract(), so there is no
+   * opportunity for a System to restrict old solution vectors; any
+   * data projection must happen before calling this.  Node positions
+   * are not restored the way Elem::coarsen() restores them, the
+   * level-one rule is not enforced, and on a distributed mesh the map
+   * must be the same on all processors.
+   *
+   * \returns \p true if the mesh changed.
+   */
+  bool coarsen_subtrees (const std::map<dof_id_type, unsigned int> & subtree_target_levels);
+
+  /**
+   * Convenience overload which collapses every subtree to
+   * \p target_level, as in a reset to \p target_level levels of
+   * uniform refinement.
+   */
+  bool coarsen_subtrees (unsigned int target_level);
+
   /**
    * Uniformly p refines the mesh \p n times.
    */
@@ -476,6 +540,36 @@ public:
    */
   signed char & underrefined_boundary_limit();
 
+  /**
+   * Restricts subsequent refinement and coarsening bookkeeping to
+   * elements whose loose bounding boxes intersect \p window inflated
+   * by \p halo.  Elements outside the window have any h and p
+   * refinement flags cleared at the start of each refinement cycle,
+   * and the flag smoothing and neighbor fixup loops skip them, so the
+   * expensive per-step AMR work scales with the window contents
+   * rather than the whole mesh.  The window can be moved (by calling
+   * this again) between steps to track a traveling front.
+   *
+   * The halo must be wide enough to cover every element whose
+   * refinement state can legitimately change when the windowed
+   * elements change theirs; with the default
+   * face_level_mismatch_limit() of 1, a few coarse element diameters
+   * suffice.
+   */
+  void set_refinement_window (const BoundingBox & window, Real halo = 0.);
+
+  /**
+   * Removes any refinement window, restoring whole-mesh refinement
+   * and coarsening.
+   */
+  void clear_refinement_window ();
+
+  /**
+   * \returns \p true if \p elem intersects the refinement window
+   * (including its halo), or if no window is set.
+   */
+  bool element_in_refinement_window (const Elem * elem) const;
+
 
   /**
    * Copy refinement flags on ghost elements from their
@@ -704,6 +798,20 @@ private:
                                    Real & parent_error_min,
                                    Real & parent_error_max);
 
+  /**
+   * \returns The (\p n + 1)-th smallest entry of the distributed
+   * vector whose local portion on each processor is \p local_values,
+   * without ever gathering that vector onto any one processor.
+   *
+   * The selection works by bisection on a distributed histogram: each
+   * iteration bins the local values falling in the current bracket,
+   * sums the bin counts across processors, and narrows the bracket to
+   * the bin containing entry \p n, until the bracket can no longer be
+   * resolved in floating point.
+   */
+  ErrorVectorReal distributed_nth_smallest (const std::vector<ErrorVectorReal> & local_values,
+                                            dof_id_type n) const;
+
   /**
    * Updates the \p _new_nodes_map
    */
@@ -855,6 +963,15 @@ private:
    */
   bool _enforce_mismatch_limit_prior_to_refinement;
 
+  /**
+   * If \p _have_refinement_window is true, refinement and coarsening
+   * bookkeeping is restricted to elements intersecting
+   * \p _refinement_window, which is stored pre-inflated by the halo
+   * passed to set_refinement_window().
+   */
+  bool _have_refinement_window;
+  BoundingBox _refinement_window;
+
   /**
    * This helper function enforces the desired mismatch limits prior
    * to refinement.  It is called from the
@@ -965,6 +1082,20 @@ inline bool & MeshRefinement::enforce_mismatch_limit_prior_to_refinement()
   return _enforce_mismatch_limit_prior_to_refinement;
 }
 
+inline void MeshRefinement::set_refinement_window (const BoundingBox & window,
+                                                   Real halo)
+{
+  _refinement_window = window;
+  _refinement_window.first  -= Point(halo, halo, halo);
+  _refinement_window.second += Point(halo, halo, halo);
+  _have_refinement_window = true;
+}
+
+inline void MeshRefinement::clear_refinement_window ()
+{
+  _have_refinement_window = false;
+}
+
 
 
 } // namespace libMesh
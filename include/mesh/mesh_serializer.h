@@ -20,8 +20,10 @@
 #define LIBMESH_MESH_SERIALIZER_H
 
 // Local includes
+#include "libmesh/id_types.h"
 
 // C++ includes
+#include <functional>
 
 
 namespace libMesh
@@ -46,6 +48,33 @@ public:
 
   ~MeshSerializer();
 
+  /**
+   * Streams \p mesh through processor 0 in bounded-size pieces, for
+   * consumers which only need a single ordered pass over a serialized
+   * mesh and should not pay the full gather_to_zero() memory spike.
+   *
+   * For each chunk of \p chunk_size consecutive element ids, the
+   * elements in that id range are gathered from their owners into a
+   * scratch mesh on processor 0, \p consumer is invoked there with
+   * that scratch mesh and the half-open id range [first_id, end_id)
+   * it covers, and the scratch mesh is discarded before the next
+   * chunk is gathered.  The scratch mesh holds the chunk's elements
+   * together with their ancestors and connected nodes (and their
+   * boundary ids), but is never prepared for use: neighbor pointers
+   * and the like are not set up.  Ancestors may fall outside the
+   * chunk's id range and reappear with later chunks, so consumers
+   * must select elements by the id range they are handed.
+   *
+   * A \p chunk_size of zero picks a default.  Must be run on all
+   * processors at once; \p consumer is only invoked on processor 0.
+   */
+  static void chunked_serialize
+    (const MeshBase & mesh,
+     const std::function<void (const MeshBase & chunk,
+                               dof_id_type first_id,
+                               dof_id_type end_id)> & consumer,
+     dof_id_type chunk_size = 0);
+
 private:
   MeshBase & _mesh;
   bool reparallelize;
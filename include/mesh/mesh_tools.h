@@ -367,6 +367,70 @@ void find_hanging_nodes_and_parents(const MeshBase & mesh,
 void correct_node_proc_ids(MeshBase &);
 
 
+/**
+ * Deletes the \p old_dof_object on every node and element of \p
+ * mesh.
+ *
+ * DofMap::distribute_dofs() snapshots the indexing of each
+ * dof-bearing object into a heap-allocated \p old_dof_object, which
+ * is consulted during AMR solution restriction and prolongation and
+ * is not freed until the next redistribution.  On deeply refined
+ * meshes these snapshots are a significant fraction of mesh memory,
+ * so applications may call this to reclaim them once any projections
+ * between the old and new dof distributions are complete.  Calling
+ * it at the wrong time - between DofMap::distribute_dofs() and a
+ * projection which consults old dof indices - will invalidate that
+ * projection, so this is never done automatically.
+ */
+void clear_old_dof_objects(MeshBase & mesh);
+
+
+/**
+ * How thoroughly the libmesh_assert_* mesh verification sweeps below
+ * should examine the mesh.  \p VERIFY_NONE turns every sweep into an
+ * immediate return, guaranteeing that no mesh traversal or collective
+ * communication is performed.  \p VERIFY_SAMPLED restricts the
+ * per-object consistency checks to a pseudorandom subset of object
+ * ids (1% by default; see set_verification_sampling()), so some
+ * safety is retained at a small fraction of the cost; checks whose
+ * correctness requires visiting every object, such as id
+ * monotonicity, still run in full.  \p VERIFY_FULL, the default,
+ * preserves the historical check-everything behavior.
+ */
+enum VerificationLevel : int {
+  VERIFY_NONE    = 0,
+  VERIFY_SAMPLED = 1,
+  VERIFY_FULL    = 2 };
+
+/**
+ * Sets the verification level used by subsequent libmesh_assert_*
+ * mesh sweeps.  Many of those sweeps are collective operations, so
+ * the same level must be set on all processors.
+ */
+void set_verification_level (VerificationLevel level);
+
+/**
+ * \returns The currently selected mesh verification level.
+ */
+VerificationLevel verification_level ();
+
+/**
+ * Sets the fraction of object ids examined under \p VERIFY_SAMPLED,
+ * along with a seed varying which subset gets picked.  Both must be
+ * set consistently across processors.
+ */
+void set_verification_sampling (Real fraction, unsigned int seed = 0);
+
+/**
+ * \returns Whether the object with id \p id should be examined at the
+ * current verification level.  The sampled subset is chosen by a
+ * deterministic hash of the id, so distributed checks skip the same
+ * ids on every processor and their collective communication stays
+ * consistent.
+ */
+bool verify_object_id (dof_id_type id);
+
+
 #ifdef DEBUG
 /**
  * A function for verifying that an element has been cut off
@@ -21,6 +21,7 @@
 #define LIBMESH_NAMEBASED_IO_H
 
 // Local includes
+#include "libmesh/mesh_file_metadata.h"
 #include "libmesh/mesh_output.h"
 #include "libmesh/mesh_input.h"
 
@@ -65,6 +66,18 @@ public:
    */
   virtual void read (const std::string & mesh_file) override;
 
+  /**
+   * Reads summary metadata from \p mesh_file - counts, subdomain and
+   * boundary id sets, and the nodal bounding box - without modifying
+   * the MeshBase.  Formats with header support (ExodusII, XDA/XDR,
+   * Checkpoint) supply what their headers record without constructing
+   * a single Elem; see the \p have_* flags on the returned
+   * MeshFileMetadata for what each was able to fill in.  Other
+   * formats fall back to a full read into a scratch mesh, which is
+   * complete but no faster than read().
+   */
+  MeshFileMetadata read_metadata (const std::string & mesh_file);
+
   /**
    * This method implements writing a mesh to a specified file.
    */
@@ -125,6 +138,7 @@ NameBasedIO::is_parallel_file_format (const std::string & name)
 {
   return ((name.rfind(".xda") < name.size()) ||
           (name.rfind(".xdr") < name.size()) ||
+          (name.rfind(".xdb") < name.size()) ||
           (name.rfind(".nem") + 4 == name.size()) ||
           (name.rfind(".n") + 2 == name.size()) ||
           (name.rfind(".cp") < name.size())
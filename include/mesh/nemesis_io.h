@@ -134,6 +134,19 @@ public:
    */
   void verbose (bool set_verbosity);
 
+  /**
+   * Serialize metadata-heavy file operations (create/open) within
+   * groups of \p group_size consecutive processors, so that at most
+   * ceil(n_processors/group_size) files are being created or opened
+   * simultaneously.  At large processor counts the simultaneous
+   * creation of one file per processor can overwhelm the metadata
+   * servers of a parallel filesystem; funneling the operations
+   * through fewer concurrent "writers" avoids that without changing
+   * the file format.  The default group size of 0 leaves all
+   * processors unthrottled.
+   */
+  void set_io_group_size (processor_id_type group_size);
+
   /**
    * Set the flag indicating whether the complex modulus should be
    * written when complex numbers are enabled. By default this flag
@@ -233,6 +246,27 @@ private:
    */
   bool _append;
 
+  /**
+   * Size of the processor groups within which file creates and opens
+   * are serialized.  0 (the default) means no throttling.
+   */
+  processor_id_type _io_group_size;
+
+  /**
+   * Blocks until the previous member of this processor's I/O group
+   * has finished its file create/open, if I/O throttling is enabled.
+   */
+  void wait_for_io_group_turn () const;
+
+  /**
+   * Passes the go-ahead for file creates/opens to the next member of
+   * this processor's I/O group, if I/O throttling is enabled.  Must
+   * be called exactly once after each wait_for_io_group_turn(), as
+   * soon as the metadata operation completes and before any
+   * collective communication.
+   */
+  void finish_io_group_turn () const;
+
   /**
    * Helper function containing code shared between the two different
    * versions of write_nodal_data which take std::vector and
@@ -0,0 +1,153 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_NODE_COORDINATE_ARRAYS_H
+#define LIBMESH_NODE_COORDINATE_ARRAYS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
+#include "libmesh/bounding_box.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * A structure-of-arrays mirror of the coordinates of a mesh's nodes.
+ *
+ * \p MeshBase implementations store one individually heap-allocated
+ * \p Node per node, so algorithms which sweep all nodal coordinates
+ * (bounding boxes, smoothing iterations, map computations) pay a
+ * pointer chase and a potential cache miss per node.  This class
+ * gathers the coordinates into contiguous x/y/z arrays once, so that
+ * repeated coordinate sweeps become streaming loops over flat memory,
+ * and optionally scatters modified coordinates back to the mesh.
+ *
+ * The mirror is a snapshot: it is *not* kept in sync with subsequent
+ * mesh modification.  Call \p sync() again after adding, deleting, or
+ * renumbering nodes.
+ *
+ * \author Benjamin S. Kirk
+ * \date 2020
+ * \brief Contiguous SoA snapshot of nodal coordinates for streaming sweeps.
+ */
+class NodeCoordinateArrays
+{
+public:
+
+  /**
+   * Constructor.  Gathers the coordinates of all nodes of \p mesh
+   * (or, on a distributed mesh, all nodes local to this processor
+   * plus ghosts) into contiguous arrays.
+   */
+  explicit
+  NodeCoordinateArrays (const MeshBase & mesh);
+
+  /**
+   * Re-gathers coordinates from the mesh, e.g. after the mesh has
+   * been modified or renumbered.
+   */
+  void sync ();
+
+  /**
+   * \returns The number of nodes mirrored in the arrays.
+   */
+  std::size_t n_nodes () const { return _ids.size(); }
+
+  /**
+   * \returns The contiguous arrays of coordinates, indexed by the
+   * array position, not by node id.  Unused dimensions are identically
+   * zero.
+   */
+  const std::vector<Real> & x () const { return _x; }
+  const std::vector<Real> & y () const { return _y; }
+  const std::vector<Real> & z () const { return _z; }
+
+  /**
+   * \returns The node id stored at array position \p i.
+   */
+  dof_id_type node_id (const std::size_t i) const { return _ids[i]; }
+
+  /**
+   * \returns The array position holding node id \p id, or
+   * \p DofObject::invalid_id if \p id is not mirrored here.
+   */
+  dof_id_type index_of (const dof_id_type id) const;
+
+  /**
+   * \returns The coordinates of node id \p id as a \p Point, read
+   * from the contiguous arrays.
+   */
+  Point point (const dof_id_type id) const;
+
+  /**
+   * Overwrites the mirrored coordinates of node id \p id.  The mesh
+   * itself is unchanged until \p scatter() is called.
+   */
+  void set_point (const dof_id_type id, const Point & p);
+
+  /**
+   * \returns The bounding box of the mirrored nodes, computed as a
+   * single streaming pass over the arrays.
+   */
+  BoundingBox bounding_box () const;
+
+  /**
+   * Writes the (possibly modified) mirrored coordinates back to
+   * \p mesh, which must have the same node ids as the mesh this
+   * object was gathered from.
+   */
+  void scatter (MeshBase & mesh) const;
+
+private:
+
+  /**
+   * The mesh we mirror.
+   */
+  const MeshBase & _mesh;
+
+  /**
+   * Node ids, parallel to the coordinate arrays.
+   */
+  std::vector<dof_id_type> _ids;
+
+  /**
+   * Inverse map from node id to array position; entries for ids we do
+   * not mirror are \p DofObject::invalid_id.
+   */
+  std::vector<dof_id_type> _id_to_index;
+
+  /**
+   * The coordinates proper.  \p _y and \p _z are zero-filled in
+   * lower-dimensional builds so callers can stream all three
+   * unconditionally.
+   */
+  std::vector<Real> _x, _y, _z;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_NODE_COORDINATE_ARRAYS_H
@@ -0,0 +1,76 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_PVTU_IO_H
+#define LIBMESH_PVTU_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_output.h"
+
+namespace libMesh
+{
+
+class MeshBase;
+
+/**
+ * This class implements writing meshes in the parallel VTK XML format
+ * (.pvtu/.vtu) directly, without going through the VTK library.  Each
+ * processor writes its local active elements as one appended
+ * raw-binary encoded .vtu piece, and processor 0 writes the .pvtu
+ * index referencing all pieces, so the writer is available (and fast)
+ * even in builds configured without VTK.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ */
+class PVTUIO : public MeshOutput<MeshBase>
+{
+public:
+  /**
+   * Constructor.  Takes a read-only reference to a mesh object.
+   */
+  explicit
+  PVTUIO (const MeshBase & mesh);
+
+  /**
+   * Bring in base class functionality for name resolution and to
+   * avoid warnings about hidden overloaded virtual functions.
+   */
+  using MeshOutput<MeshBase>::write_nodal_data;
+
+  /**
+   * This method implements writing a mesh with nodal data to a
+   * specified .pvtu file where the nodal data and variable names are
+   * provided.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const std::vector<Number> &,
+                                 const std::vector<std::string> &) override;
+
+  /**
+   * Output the mesh without solutions to a .pvtu file.
+   */
+  virtual void write (const std::string &) override;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_PVTU_IO_H
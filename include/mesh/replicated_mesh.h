@@ -172,11 +172,34 @@ public:
 
   virtual void delete_node (Node * n) override;
   virtual void renumber_node (dof_id_type old_id, dof_id_type new_id) override;
+  virtual void renumber_nodes (const std::vector<dof_id_type> & new_ids) override;
   virtual Elem * add_elem (Elem * e) override;
   virtual Elem * add_elem (std::unique_ptr<Elem> e) override;
   virtual Elem * insert_elem (Elem * e) override;
   virtual Elem * insert_elem (std::unique_ptr<Elem> e) override;
   virtual void delete_elem (Elem * e) override;
+
+  /**
+   * Deletes all the elements in \p to_delete from the mesh in one
+   * pass.  Links into the deleted set are repaired with a single
+   * sweep over the surviving elements' neighbor pointers rather than
+   * with a per-element family-tree walk, which is much cheaper when
+   * deleting a large fraction of the mesh at once, as remeshing does.
+   *
+   * If renumbering is allowed, the tombstone slots deletion leaves in
+   * the element storage are then compacted away immediately by moving
+   * the highest-numbered surviving elements into the holes: element
+   * pointers remain valid, ids change as in \p renumber_elem(), and
+   * subsequent iteration passes never pay for skipping dead slots.
+   * With \p allow_renumbering(false) the tombstones remain, exactly
+   * as after repeated \p delete_elem() calls.
+   *
+   * The deleted set must be closed under family relationships: an
+   * element may not be deleted while its parent or any of its
+   * children survive.
+   */
+  void delete_elems (const std::vector<Elem *> & to_delete);
+
   virtual void renumber_elem (dof_id_type old_id, dof_id_type new_id) override;
 
   /**
@@ -374,6 +397,15 @@ public:
   virtual const_element_iterator active_type_elements_begin (ElemType type) const override;
   virtual const_element_iterator active_type_elements_end (ElemType type) const override;
 
+  virtual element_iterator active_local_type_elements_begin (ElemType type) override;
+  virtual element_iterator active_local_type_elements_end (ElemType type) override;
+  virtual const_element_iterator active_local_type_elements_begin (ElemType type) const override;
+  virtual const_element_iterator active_local_type_elements_end (ElemType type) const override;
+  virtual SimpleRange<element_iterator> active_local_type_elements_ptr_range(ElemType type) override
+  { return {active_local_type_elements_begin(type), active_local_type_elements_end(type)}; }
+  virtual SimpleRange<const_element_iterator> active_local_type_elements_ptr_range(ElemType type) const override
+  { return {active_local_type_elements_begin(type), active_local_type_elements_end(type)}; }
+
   virtual element_iterator active_pid_elements_begin (processor_id_type proc_id) override;
   virtual element_iterator active_pid_elements_end (processor_id_type proc_id) override;
   virtual const_element_iterator active_pid_elements_begin (processor_id_type proc_id) const override;
@@ -25,6 +25,7 @@
 
 // C++ Includes
 #include <cstddef>
+#include <unordered_set>
 
 namespace libMesh
 {
@@ -175,6 +176,29 @@ public:
   virtual void find_neighbors (const bool reset_remote_elements = false,
                                const bool reset_current_list    = true) override;
 
+  /**
+   * Enables (or disables) incremental neighbor finding.  When
+   * enabled, the mesh keeps track of elements which have been added
+   * or deleted, and \p find_neighbors() reconstructs neighbor links
+   * only around those elements instead of resetting and rebuilding
+   * them over the whole mesh.  This can make \p prepare_for_use()
+   * dramatically cheaper in remeshing loops which modify only a small
+   * patch of a large mesh.
+   *
+   * Stale links of elements neighboring a deletion are nulled at
+   * deletion time, so this mode must be enabled while the mesh's
+   * neighbor pointers are intact, i.e. before the modifications it is
+   * meant to track.  Toggling it in either direction discards any
+   * tracked elements.
+   */
+  void enable_incremental_find_neighbors (bool enable);
+
+  /**
+   * \returns Whether incremental neighbor finding is enabled.
+   */
+  bool incremental_find_neighbors_enabled () const
+  { return _track_dirty_elements; }
+
 #ifdef LIBMESH_ENABLE_AMR
   /**
    * Delete subactive (i.e. children of coarsened) elements.
@@ -184,6 +208,40 @@ public:
   virtual bool contract () override;
 #endif // #ifdef LIBMESH_ENABLE_AMR
 
+protected:
+
+  /**
+   * Records a newly added element for a later incremental \p
+   * find_neighbors() pass.  A no-op unless incremental neighbor
+   * finding is enabled.  Called by the \p add_elem() and \p
+   * insert_elem() implementations in our subclasses.
+   */
+  void track_new_elem (Elem * elem);
+
+  /**
+   * Records the imminent deletion of \p elem for a later incremental
+   * \p find_neighbors() pass: the element's surviving neighbors are
+   * marked dirty and their links back to \p elem are nulled, so no
+   * dangling pointers outlive the deletion.  A no-op unless
+   * incremental neighbor finding is enabled.  Called by the \p
+   * delete_elem() implementations in our subclasses.
+   */
+  void track_deleted_elem (Elem * elem);
+
+  /**
+   * \p true if we are tracking mesh modifications for incremental
+   * neighbor finding.
+   */
+  bool _track_dirty_elements;
+
+  /**
+   * Elements whose neighbor links need reconstruction.  The pointers
+   * cannot dangle: a tracked element which is subsequently deleted
+   * passes through \p track_deleted_elem(), which removes its entry.
+   * We track pointers rather than ids because \p prepare_for_use()
+   * may renumber elements before finding neighbors.
+   */
+  std::unordered_set<Elem *> _dirty_elements;
 };
 
 
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace libMesh
@@ -185,7 +186,7 @@ private:
    * Maps UNV node IDs to libMesh Node*s. Used when reading. Even if the
    * libMesh Mesh is renumbered, this map should continue to be valid.
    */
-  std::map<dof_id_type, Node *> _unv_node_id_to_libmesh_node_ptr;
+  std::unordered_map<dof_id_type, Node *> _unv_node_id_to_libmesh_node_ptr;
 
   /**
    * label for the node dataset
@@ -205,7 +206,7 @@ private:
   /**
    * Map UNV element IDs to libmesh element IDs.
    */
-  std::map<unsigned, unsigned> _unv_elem_id_to_libmesh_elem_id;
+  std::unordered_map<unsigned, unsigned> _unv_elem_id_to_libmesh_elem_id;
 
   /**
    * Map from libMesh Node* to data at that node, as read in by the
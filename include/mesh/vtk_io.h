@@ -209,13 +209,14 @@ private:
   };
 
   /**
-   * ElementMaps object that is built statically and used by
-   * all instances of this class.
+   * \returns The ElementMaps object shared by all instances of this
+   * class, built thread-safely on first use so that programs which
+   * never touch this format never pay for it.
    */
-  static ElementMaps _element_maps;
+  static ElementMaps & element_maps();
 
   /**
-   * Static function used to construct the _element_maps struct.
+   * Static function used to construct the element_maps() struct.
    */
   static ElementMaps build_element_maps();
 
@@ -23,6 +23,7 @@
 
 // Local includes
 #include "libmesh/libmesh.h"
+#include "libmesh/mesh_file_metadata.h"
 #include "libmesh/mesh_input.h"
 #include "libmesh/mesh_output.h"
 #include "libmesh/parallel_object.h"
@@ -92,6 +93,15 @@ public:
    */
   virtual void read (const std::string &) override;
 
+  /**
+   * Reads summary metadata from the file \p name without constructing
+   * any Elem objects or modifying the MeshBase.  The XDA/XDR header
+   * only records global counts, so subdomain/boundary id sets and the
+   * bounding box are left unfilled; the corresponding \p have_* flags
+   * stay \p false.
+   */
+  MeshFileMetadata read_metadata (const std::string & name);
+
   /**
    * This method implements writing a mesh to a specified file.
    */
@@ -103,6 +113,19 @@ public:
   bool   binary() const { return _binary; }
   bool & binary()       { return _binary; }
 
+  /**
+   * Get/Set the flag indicating if we should read/write the raw
+   * memory-mappable binary format; when set it takes precedence over
+   * \p binary().  Files in this format (conventionally suffixed \p
+   * .xdb) store their node coordinate and connectivity blocks as
+   * contiguous native-endian arrays, so reading one maps the file
+   * into memory and bulk-copies those blocks instead of decoding
+   * values one at a time.  Unlike XDR files they are not portable
+   * across architectures with different endianness or word sizes.
+   */
+  bool   raw_binary() const { return _raw_binary; }
+  bool & raw_binary()       { return _raw_binary; }
+
   /**
    * Get/Set the flag indicating if we should read/write legacy.
    */
@@ -333,6 +356,7 @@ private:
                      const dof_id_type parent_pid = DofObject::invalid_id) const;
 
   bool _binary;
+  bool _raw_binary;
   bool _legacy;
   bool _write_serial;
   bool _write_parallel;
@@ -25,6 +25,7 @@
 
 // C++ includes
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <utility> // std::pair
 #include <vector>
@@ -50,6 +51,12 @@ class ConstCouplingRowConstIterator;
  * \author Benjamin S. Kirk
  * \date 2002
  * \brief Defines the coupling between variables of a System.
+ *
+ * Two storage schemes are used, chosen automatically by size: small
+ * matrices (up to \p dense_size_threshold variables) store a dense
+ * bitset, giving O(1) entry tests and word-at-a-time row iteration,
+ * while larger matrices keep the run-length encoded form, whose
+ * memory use stays proportional to pattern complexity.
  */
 class CouplingMatrix
 {
@@ -98,6 +105,12 @@ public:
 
   CouplingMatrix & operator&= (const CouplingMatrix & other);
 
+  /**
+   * The largest matrix size for which we use the dense bitset
+   * representation rather than run-length encoding.
+   */
+  static const unsigned int dense_size_threshold = 256;
+
 private:
 
   friend class ConstCouplingAccessor;
@@ -109,10 +122,10 @@ private:
    * Coupling matrices are typically either full or very sparse, and
    * all values are only zero or one.
    *
-   * We store non-zeros as ranges: the first entry of each range pair
-   * is the location of the first non-zero, and the second is the
-   * location of the last subsequent non-zero (*not* the next
-   * subsequent zero; we drop empty ranges).
+   * For larger matrices we store non-zeros as ranges: the first entry
+   * of each range pair is the location of the first non-zero, and the
+   * second is the location of the last subsequent non-zero (*not* the
+   * next subsequent zero; we drop empty ranges).
    *
    * We store locations (i,j) as long integers i*_size+j
    */
@@ -120,10 +133,41 @@ private:
   typedef std::vector<range_type> rc_type;
   rc_type _ranges;
 
+  /**
+   * For matrices of up to dense_size_threshold variables we instead
+   * store one bit per location, packed into words.
+   */
+  typedef std::uint64_t bitword_type;
+  std::vector<bitword_type> _bits;
+
+  /**
+   * \returns The bit at location \p loc of the dense representation.
+   */
+  bool test_bit (const std::size_t loc) const;
+
+  /**
+   * Sets the bit at location \p loc of the dense representation.
+   */
+  void set_bit (const std::size_t loc, const bool val);
+
+  /**
+   * \returns The first location in [\p loc, \p last] whose dense
+   * bit is set, scanning word-at-a-time, or
+   * \p std::numeric_limits<std::size_t>::max() if there is none.
+   */
+  std::size_t first_set_location (std::size_t loc,
+                                  const std::size_t last) const;
+
   /**
    * The size of the matrix.
    */
   unsigned int _size;
+
+  /**
+   * Are we using the dense bitset representation?  Chosen
+   * automatically at resize() time.
+   */
+  bool _dense;
 };
 
 
@@ -142,6 +186,9 @@ public:
   }
 
   operator bool() const {
+    if (_mat._dense)
+      return _mat.test_bit(_location);
+
     const std::size_t max_size = std::numeric_limits<std::size_t>::max();
 
     // Find the range that might contain i,j
@@ -208,6 +255,12 @@ public:
 
   CouplingAccessor & operator = (bool new_value)
   {
+    if (_my_mat._dense)
+      {
+        _my_mat.set_bit(_location, new_value);
+        return *this;
+      }
+
     const std::size_t max_size = std::numeric_limits<std::size_t>::max();
 
     // Find the range that might contain i,j
@@ -342,6 +395,17 @@ public:
   {
     libmesh_assert_less(_row_i, _mat.size());
 
+    if (_mat._dense)
+      {
+        // Scan the row's words for its first set bit; an all-zero
+        // row gets the empty-row sentinel.
+        _begin_it = _mat._ranges.end();
+        _begin_location =
+          _mat.first_set_location (std::size_t(_row_i)*_mat.size(),
+                                   _end_location);
+        return;
+      }
+
     // Location for i,N, where we'll start looking for our beginning
     // range
     _begin_location = _end_location;
@@ -464,7 +528,14 @@ public:
     _it(it_in)
   {
 #ifndef NDEBUG
-    if (_it != _row._mat._ranges.end())
+    if (_row._mat._dense)
+      {
+        // The dense representation doesn't use range iterators
+        libmesh_assert(_it == _row._mat._ranges.end());
+        libmesh_assert(_location <= _row._end_location ||
+                       _location == std::numeric_limits<size_t>::max());
+      }
+    else if (_it != _row._mat._ranges.end())
       {
         libmesh_assert_less_equal(_it->first, _location);
         libmesh_assert_less_equal(_location, _it->second);
@@ -488,6 +559,15 @@ public:
   {
     libmesh_assert_not_equal_to
       (_location, std::numeric_limits<std::size_t>::max());
+
+    if (_row._mat._dense)
+      {
+        _location = (_location >= _row._end_location) ?
+          std::numeric_limits<std::size_t>::max() :
+          _row._mat.first_set_location(_location+1, _row._end_location);
+        return *this;
+      }
+
     libmesh_assert
       (_it != _row._mat._ranges.end());
 
@@ -566,13 +646,78 @@ ConstCouplingRow::const_iterator ConstCouplingRow::end() const {
 // CouplingMatrix inline methods
 inline
 CouplingMatrix::CouplingMatrix (const unsigned int n) :
-  _ranges(), _size(n)
+  _ranges(), _bits(), _size(n), _dense(false)
 {
   this->resize(n);
 }
 
 
 
+inline
+bool CouplingMatrix::test_bit (const std::size_t loc) const
+{
+  libmesh_assert(_dense);
+  libmesh_assert_less(loc >> 6, _bits.size());
+
+  return (_bits[loc >> 6] >> (loc & 63)) & 1;
+}
+
+
+
+inline
+void CouplingMatrix::set_bit (const std::size_t loc, const bool val)
+{
+  libmesh_assert(_dense);
+  libmesh_assert_less(loc >> 6, _bits.size());
+
+  const bitword_type mask = bitword_type(1) << (loc & 63);
+  if (val)
+    _bits[loc >> 6] |= mask;
+  else
+    _bits[loc >> 6] &= ~mask;
+}
+
+
+
+inline
+std::size_t CouplingMatrix::first_set_location (std::size_t loc,
+                                                const std::size_t last) const
+{
+  libmesh_assert(_dense);
+
+  const std::size_t max_size = std::numeric_limits<std::size_t>::max();
+
+  if (loc > last)
+    return max_size;
+
+  libmesh_assert_less(last >> 6, _bits.size());
+
+  // Mask off any bits below loc in its word, then skip zero words
+  // wholesale
+  std::size_t word = loc >> 6;
+  const std::size_t last_word = last >> 6;
+  bitword_type bits = _bits[word] & (~bitword_type(0) << (loc & 63));
+
+  while (!bits)
+    {
+      if (++word > last_word)
+        return max_size;
+      bits = _bits[word];
+    }
+
+  // Find the lowest set bit of the word we stopped on
+  std::size_t found = word << 6;
+  while (!(bits & 1))
+    {
+      bits >>= 1;
+      ++found;
+    }
+
+  return (found > last) ? max_size : found;
+}
+
+
+
 inline
 bool CouplingMatrix::operator() (const unsigned int i,
                                  const unsigned int j) const
@@ -612,7 +757,12 @@ void CouplingMatrix::resize(const unsigned int n)
 {
   _size = n;
 
+  _dense = (n != 0 && n <= dense_size_threshold);
+
   _ranges.clear();
+  _bits.clear();
+  if (_dense)
+    _bits.resize((std::size_t(n)*n + 63) / 64);
 }
 
 
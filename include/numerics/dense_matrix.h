@@ -65,6 +65,7 @@ namespace libMesh
 
 // Forward Declarations
 template <typename T> class DenseVector;
+template <typename T> class DenseMatrixWorkspace;
 
 /**
  * Defines a dense matrix for use in Finite Element-type computations.
@@ -464,6 +465,22 @@ public:
            DenseMatrix<Number> & U,
            DenseMatrix<Number> & VT);
 
+  /**
+   * Workspace-reusing variants of the svd() overloads above.  The
+   * LAPACK work arrays live in the caller-held \p workspace, where
+   * they are sized by a workspace query the first time a given
+   * problem shape is seen and reused on every subsequent call, so
+   * hot loops decomposing many same-sized matrices avoid both the
+   * per-call query and the per-call allocations.
+   */
+  void svd(DenseVector<Real> & sigma,
+           DenseMatrixWorkspace<T> & workspace);
+
+  void svd(DenseVector<Real> & sigma,
+           DenseMatrix<Number> & U,
+           DenseMatrix<Number> & VT,
+           DenseMatrixWorkspace<T> & workspace);
+
   /**
    * Solve the system of equations \f$ A x = rhs \f$ for \f$ x \f$ in the
    * least-squares sense. \f$ A \f$ may be non-square and/or rank-deficient.
@@ -485,6 +502,15 @@ public:
                  DenseVector<T> & x,
                  Real rcond=std::numeric_limits<Real>::epsilon()) const;
 
+  /**
+   * Workspace-reusing variant of svd_solve(); see the svd() overloads
+   * taking a DenseMatrixWorkspace for the reuse semantics.
+   */
+  void svd_solve(const DenseVector<T> & rhs,
+                 DenseVector<T> & x,
+                 DenseMatrixWorkspace<T> & workspace,
+                 Real rcond=std::numeric_limits<Real>::epsilon()) const;
+
   /**
    * Compute the eigenvalues (both real and imaginary parts) of a general matrix.
    *
@@ -685,7 +711,8 @@ private:
    * Lapack routine "getsvd".
    * [ Implementation in dense_matrix_blas_lapack.C ]
    */
-  void _svd_lapack(DenseVector<Real> & sigma);
+  void _svd_lapack(DenseVector<Real> & sigma,
+                   DenseMatrixWorkspace<T> * workspace = nullptr);
 
   /**
    * Computes a "reduced" SVD of the matrix using the
@@ -694,14 +721,32 @@ private:
    */
   void _svd_lapack(DenseVector<Real> & sigma,
                    DenseMatrix<Number> & U,
-                   DenseMatrix<Number> & VT);
+                   DenseMatrix<Number> & VT,
+                   DenseMatrixWorkspace<T> * workspace = nullptr);
 
   /**
    * Called by svd_solve(rhs).
    */
   void _svd_solve_lapack(const DenseVector<T> & rhs,
                          DenseVector<T> & x,
-                         Real rcond) const;
+                         Real rcond,
+                         DenseMatrixWorkspace<T> * workspace = nullptr) const;
+
+  /**
+   * Solves the least-squares problem \f$ \min \|Ax - rhs\| \f$ with a
+   * native unblocked Householder QR factorization, skipping LAPACK
+   * dispatch entirely.  Only overdetermined problems small enough
+   * for the dispatch overhead to matter are handled.
+   *
+   * \returns \p true if \p x was computed, \p false if the problem
+   * shape is out of scope or a (nearly) rank-deficient column was
+   * detected, in which case the caller should use the rank-revealing
+   * LAPACK path instead.
+   * [ Implementation in dense_matrix_impl.h ]
+   */
+  bool _qr_least_squares_unblocked(const DenseVector<T> & rhs,
+                                   DenseVector<T> & x,
+                                   Real rcond) const;
 
   /**
    * Helper function that actually performs the SVD.
@@ -711,7 +756,8 @@ private:
                     char JOBVT,
                     std::vector<Real> & sigma_val,
                     std::vector<Number> & U_val,
-                    std::vector<Number> & VT_val);
+                    std::vector<Number> & VT_val,
+                    DenseMatrixWorkspace<T> * workspace = nullptr);
 
   /**
    * Computes the eigenvalues of the matrix using the Lapack routine
@@ -766,6 +812,99 @@ private:
                     DenseVector<T> & dest,
                     const DenseVector<T> & arg,
                     bool trans=false) const;
+
+  /**
+   * Computes dest = (*this) * arg for a square matrix whose dimension
+   * \p N is fixed at compile time, so the compiler can fully unroll
+   * and vectorize the loops.  \p dest must already hold \p N entries.
+   * Only called through _vector_mult_small().
+   */
+  template <unsigned int N, typename T2, typename T3>
+  void _vector_mult_fixed (T2 * dest, const T3 * arg) const;
+
+  /**
+   * Dispatches a matrix-vector product to _vector_mult_fixed() when
+   * the matrix is square and of one of the small sizes which commonly
+   * arise as element matrices in finite element assembly.
+   *
+   * \returns \p true if a fixed-size kernel handled the product,
+   * \p false if the caller should fall back to its generic path.
+   */
+  template <typename T2, typename T3>
+  bool _vector_mult_small (T2 * dest, const T3 * arg) const;
+};
+
+
+
+/**
+ * Caller-held scratch workspace for the DenseMatrix decomposition
+ * APIs.  The LAPACK work arrays are sized by a workspace query the
+ * first time a given routine sees a given problem shape and reused
+ * on every subsequent call, so hot loops (patch recovery, reduced
+ * basis greedy sweeps) decomposing millions of same-sized small
+ * matrices stop paying a query plus fresh allocations per call.
+ * All arrays grow on demand and are never shrunk.
+ *
+ * A workspace may be shared freely across matrices and problem
+ * shapes, but not across threads; use one per thread.
+ *
+ * \author John W. Peterson
+ * \date 2020
+ * \brief Reusable work arrays for DenseMatrix decompositions.
+ */
+template <typename T>
+class DenseMatrixWorkspace
+{
+public:
+  DenseMatrixWorkspace () = default;
+
+  /**
+   * \returns \p true if the cached workspace query was made for
+   * LAPACK routine \p tag on an \p m by \p n problem.
+   */
+  bool query_matches (char tag, unsigned int m, unsigned int n) const
+  { return _tag == tag && _m == m && _n == n; }
+
+  /**
+   * Caches the optimal work array size \p lwork returned by a
+   * workspace query for routine \p tag on an \p m by \p n problem.
+   */
+  void set_query (char tag, unsigned int m, unsigned int n, int lwork)
+  { _tag = tag; _m = m; _n = n; _lwork = lwork; }
+
+  /**
+   * \returns The cached optimal work array size.
+   */
+  int queried_lwork () const { return _lwork; }
+
+  /**
+   * WORK array for routines operating on the matrix value type.
+   */
+  std::vector<T> work;
+
+  /**
+   * WORK array for routines operating on \p Number values (gesvd).
+   */
+  std::vector<Number> number_work;
+
+  /**
+   * Real-valued scratch, e.g. the RWORK array of complex routines.
+   */
+  std::vector<Real> real_work;
+
+  /**
+   * Scratch matrix, e.g. for the transposed copy the column-major
+   * least-squares path makes.
+   */
+  DenseMatrix<T> scratch;
+
+private:
+  /**
+   * The routine tag, shape and result of the cached workspace query.
+   */
+  char _tag = 0;
+  unsigned int _m = 0, _n = 0;
+  int _lwork = 0;
 };
 
 
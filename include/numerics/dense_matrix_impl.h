@@ -396,6 +396,51 @@ void DenseMatrix<T>::right_multiply_transpose (const DenseMatrix<T2> & B)
 
 
 
+template<typename T>
+template<unsigned int N, typename T2, typename T3>
+inline
+void DenseMatrix<T>::_vector_mult_fixed (T2 * dest, const T3 * arg) const
+{
+  const T * mat = this->_val.data();
+
+  for (unsigned int i=0; i<N; i++)
+    {
+      T2 sum = 0;
+      for (unsigned int j=0; j<N; j++)
+        sum += mat[i*N+j] * arg[j];
+      dest[i] = sum;
+    }
+}
+
+
+
+template<typename T>
+template<typename T2, typename T3>
+inline
+bool DenseMatrix<T>::_vector_mult_small (T2 * dest, const T3 * arg) const
+{
+  if (this->m() != this->n())
+    return false;
+
+  // The sizes below cover the element matrices produced by our most
+  // common geometric element/FE order combinations, e.g. 8x8 for
+  // HEX8, 27x27 for HEX27 and 30x30 for second-order vector-valued
+  // variables on TET10.
+  switch (this->m())
+    {
+    case 4:  _vector_mult_fixed<4>  (dest, arg); return true;
+    case 8:  _vector_mult_fixed<8>  (dest, arg); return true;
+    case 9:  _vector_mult_fixed<9>  (dest, arg); return true;
+    case 10: _vector_mult_fixed<10> (dest, arg); return true;
+    case 20: _vector_mult_fixed<20> (dest, arg); return true;
+    case 27: _vector_mult_fixed<27> (dest, arg); return true;
+    case 30: _vector_mult_fixed<30> (dest, arg); return true;
+    default: return false;
+    }
+}
+
+
+
 template<typename T>
 void DenseMatrix<T>::vector_mult (DenseVector<T> & dest,
                                   const DenseVector<T> & arg) const
@@ -411,6 +456,14 @@ void DenseMatrix<T>::vector_mult (DenseVector<T> & dest,
   if(this->m() == 0 || this->n() == 0)
     return;
 
+  // For the small square sizes which dominate finite element
+  // assembly, a kernel with compile-time trip counts beats both the
+  // generic loops and a BLAS call, whose setup overhead exceeds the
+  // arithmetic at these sizes.
+  if (this->_vector_mult_small (dest.get_values().data(),
+                                arg.get_values().data()))
+    return;
+
   if (this->use_blas_lapack)
     this->_matvec_blas(1., 0., dest, arg);
   else
@@ -442,6 +495,12 @@ void DenseMatrix<T>::vector_mult (DenseVector<typename CompareTypes<T,T2>::super
   if (this->m() == 0 || this->n() == 0)
     return;
 
+  // Common small square sizes go to a fixed-size kernel; see the
+  // homogeneous-type overload above.
+  if (this->_vector_mult_small (dest.get_values().data(),
+                                arg.get_values().data()))
+    return;
+
   const unsigned int n_rows = this->m();
   const unsigned int n_cols = this->n();
 
@@ -823,16 +882,155 @@ void DenseMatrix<T>::svd (DenseVector<Real> & sigma,
 
 
 
+template<typename T>
+void DenseMatrix<T>::svd (DenseVector<Real> & sigma,
+                          DenseMatrixWorkspace<T> & workspace)
+{
+  _svd_lapack(sigma, &workspace);
+}
+
+
+
+template<typename T>
+void DenseMatrix<T>::svd (DenseVector<Real> & sigma,
+                          DenseMatrix<Number> & U,
+                          DenseMatrix<Number> & VT,
+                          DenseMatrixWorkspace<T> & workspace)
+{
+  _svd_lapack(sigma, U, VT, &workspace);
+}
+
+
+
 template<typename T>
 void DenseMatrix<T>::svd_solve(const DenseVector<T> & rhs,
                                DenseVector<T> & x,
                                Real rcond) const
 {
+  // Small well-conditioned problems are cheaper without LAPACK
+  if (this->_qr_least_squares_unblocked(rhs, x, rcond))
+    return;
+
   _svd_solve_lapack(rhs, x, rcond);
 }
 
 
 
+template<typename T>
+void DenseMatrix<T>::svd_solve(const DenseVector<T> & rhs,
+                               DenseVector<T> & x,
+                               DenseMatrixWorkspace<T> & workspace,
+                               Real rcond) const
+{
+  // Small well-conditioned problems are cheaper without LAPACK
+  if (this->_qr_least_squares_unblocked(rhs, x, rcond))
+    return;
+
+  _svd_solve_lapack(rhs, x, rcond, &workspace);
+}
+
+
+
+template<typename T>
+bool DenseMatrix<T>::_qr_least_squares_unblocked (const DenseVector<T> & rhs,
+                                                  DenseVector<T> & x,
+                                                  Real rcond) const
+{
+  const unsigned int m = this->m(), n = this->n();
+
+  // The native path only pays off below the scale of a LAPACK
+  // dispatch, and only handles overdetermined full-rank problems;
+  // everything else keeps the rank-revealing LAPACK treatment.
+  if (m >= 32 || n >= 32 || m < n || n == 0)
+    return false;
+
+  libmesh_assert_equal_to (rhs.size(), m);
+
+  // Match the gelss convention: a negative rcond requests machine
+  // precision.
+  const Real tol =
+    (rcond < 0) ? std::numeric_limits<Real>::epsilon() : rcond;
+
+  DenseMatrix<T> qr(*this);
+  DenseVector<T> qtb(rhs);
+
+  Real r00 = 0;
+
+  // Unblocked Householder QR, applying each reflection to the
+  // trailing columns and the right-hand side as it is formed.
+  for (unsigned int k = 0; k != n; ++k)
+    {
+      Real sq_colnorm = 0;
+      for (unsigned int i = k; i != m; ++i)
+        {
+          const Real absval = std::abs(qr(i,k));
+          sq_colnorm += absval * absval;
+        }
+      const Real colnorm = std::sqrt(sq_colnorm);
+
+      if (k == 0)
+        r00 = colnorm;
+
+      // A (nearly) rank-deficient column; bail out and let the
+      // caller compute a minimum-norm solution instead.
+      if (colnorm <= tol * r00 || colnorm == Real(0))
+        return false;
+
+      // The reflection maps column k onto -phase*colnorm * e_k; the
+      // phase factor keeps the v_k update below cancellation-free.
+      const T alpha = qr(k,k);
+      const Real abs_alpha = std::abs(alpha);
+      const T phase = (abs_alpha == Real(0)) ?
+        T(1) : T(alpha * (Real(1) / abs_alpha));
+      const T vk = alpha + phase * colnorm;
+
+      // v^H v, for v = (vk, A(k+1,k), ..., A(m-1,k))
+      const Real sq_vk = std::abs(vk) * std::abs(vk);
+      const Real vtv = sq_vk + (sq_colnorm - abs_alpha * abs_alpha);
+
+      // Apply H = I - 2 v v^H / (v^H v) to the right-hand side and
+      // the trailing columns, with v still stored in column k.
+      {
+        T dot = libmesh_conj(vk) * qtb(k);
+        for (unsigned int i = k+1; i != m; ++i)
+          dot += libmesh_conj(qr(i,k)) * qtb(i);
+        dot *= Real(2) / vtv;
+
+        qtb(k) -= dot * vk;
+        for (unsigned int i = k+1; i != m; ++i)
+          qtb(i) -= dot * qr(i,k);
+      }
+
+      for (unsigned int j = k+1; j != n; ++j)
+        {
+          T dot = libmesh_conj(vk) * qr(k,j);
+          for (unsigned int i = k+1; i != m; ++i)
+            dot += libmesh_conj(qr(i,k)) * qr(i,j);
+          dot *= Real(2) / vtv;
+
+          qr(k,j) -= dot * vk;
+          for (unsigned int i = k+1; i != m; ++i)
+            qr(i,j) -= dot * qr(i,k);
+        }
+
+      qr(k,k) = -phase * colnorm;
+    }
+
+  // Back substitution of R x = (Q^H b)(0:n-1)
+  x.resize(n);
+  for (unsigned int k = n; k-- != 0;)
+    {
+      T val = qtb(k);
+      for (unsigned int j = k+1; j != n; ++j)
+        val -= qr(k,j) * x(j);
+      x(k) = val / qr(k,k);
+    }
+
+  return true;
+}
+
+
+
 template<typename T>
 void DenseMatrix<T>::evd (DenseVector<T> & lambda_real,
                           DenseVector<T> & lambda_imag)
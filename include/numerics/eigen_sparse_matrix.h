@@ -137,6 +137,12 @@ public:
 
   virtual bool closed() const override { return _closed; }
 
+  /**
+   * \returns An estimate of the compressed-sparse-row storage in
+   * bytes.
+   */
+  virtual std::size_t memory_footprint () const override;
+
   virtual void print_personal(std::ostream & os=libMesh::out) const override { this->print(os); }
 
   virtual void get_diagonal (NumericVector<T> & dest) const override;
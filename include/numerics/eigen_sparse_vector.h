@@ -189,6 +189,13 @@ public:
 
   virtual void add (const T a, const NumericVector<T> & v) override;
 
+  /**
+   * Fused multi-axpy; all the terms are accumulated in a single sweep
+   * over the storage.
+   */
+  virtual void add_vectors (const std::vector<T> & a,
+                            const std::vector<const NumericVector<T> *> & v) override;
+
   /**
    * We override one NumericVector<T>::add_vector() method but don't
    * want to hide the other defaults.
@@ -207,6 +214,12 @@ public:
 
   virtual T dot(const NumericVector<T> & v) const override;
 
+  /**
+   * Batched dot products, computed in one pass over *this.
+   */
+  virtual void dot_vectors (const std::vector<const NumericVector<T> *> & v,
+                            std::vector<T> & results) const override;
+
   virtual void localize (std::vector<T> & v_local) const override;
 
   virtual void localize (NumericVector<T> & v_local) const override;
@@ -27,6 +27,7 @@
 // C++ includes
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -125,6 +126,35 @@ public:
                            const Real time,
                            DenseVector<Output> & output) = 0;
 
+  /**
+   * Evaluates the scalar function at every entry of \p points at
+   * once, writing the values into \p output.
+   *
+   * \note Subclasses aren't required to override this; the default
+   * implementation just loops over the scalar \p operator().
+   *
+   * \note Subclasses whose evaluations share per-call setup cost
+   * (parsed expressions, table lookups, etc.) are recommended to
+   * override this and hoist that cost out of the loop; batch callers
+   * such as the Dirichlet boundary projection go through this
+   * interface one quadrature rule at a time.
+   */
+  virtual void operator() (const std::vector<Point> & points,
+                           const Real time,
+                           std::vector<Output> & output);
+
+  /**
+   * Evaluates the vector component \p i at every entry of \p points
+   * at once, writing the values into \p output.
+   *
+   * \note Subclasses aren't required to override this; the default
+   * implementation just loops over the scalar \p component().
+   */
+  virtual void component (unsigned int i,
+                          const std::vector<Point> & points,
+                          Real time,
+                          std::vector<Output> & output);
+
   /**
    * \returns The vector component \p i at coordinate \p p and time \p
    * time.
@@ -244,6 +274,33 @@ void FunctionBase<Output>::operator() (const Point & p,
   this->operator()(p, 0., output);
 }
 
+
+
+template <typename Output>
+inline
+void FunctionBase<Output>::operator() (const std::vector<Point> & points,
+                                       const Real time,
+                                       std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t p = 0; p != points.size(); ++p)
+    output[p] = (*this)(points[p], time);
+}
+
+
+
+template <typename Output>
+inline
+void FunctionBase<Output>::component (unsigned int i,
+                                      const std::vector<Point> & points,
+                                      Real time,
+                                      std::vector<Output> & output)
+{
+  output.resize(points.size());
+  for (std::size_t p = 0; p != points.size(); ++p)
+    output[p] = this->component(i, points[p], time);
+}
+
 } // namespace libMesh
 
 #endif // LIBMESH_FUNCTION_BASE_H
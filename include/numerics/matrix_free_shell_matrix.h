@@ -0,0 +1,140 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MATRIX_FREE_SHELL_MATRIX_H
+#define LIBMESH_MATRIX_FREE_SHELL_MATRIX_H
+
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/reference_counted_object.h"
+#include "libmesh/libmesh.h"
+#include "libmesh/shell_matrix.h"
+#include "libmesh/dense_matrix.h"
+
+// C++ includes
+#include <memory>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class System;
+template <typename T> class NumericVector;
+
+/**
+ * This class implements a matrix-free linear operator.  Instead of
+ * assembling a global sparse matrix, the action of the operator on a
+ * vector is computed on the fly by looping over the active local
+ * elements, calling a user-supplied kernel for each element matrix,
+ * and accumulating the element products.  Attached to a
+ * LinearImplicitSystem via \p attach_shell_matrix(), this enables
+ * CG/GMRES solves with a fraction of the memory footprint of an
+ * assembled matrix, at the cost of recomputing element matrices on
+ * each operator application.
+ *
+ * The element kernel will typically \p reinit an FE object for each
+ * element; the reference-element shape function values are cached
+ * inside \p FE between reinits, so only the mapping-dependent work is
+ * repeated.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ */
+template <typename T>
+class MatrixFreeShellMatrix : public ShellMatrix<T>
+{
+public:
+  /**
+   * Abstract base class for the element kernel.  A derived class
+   * computes the element matrix for one element, exactly as a
+   * conventional assembly loop body would before calling \p
+   * SparseMatrix::add_matrix().  The same kernel object is reused
+   * for every element, so FE objects held by the kernel keep their
+   * cached reference-element data across calls.
+   */
+  class ElementKernel
+  {
+  public:
+    virtual ~ElementKernel () {}
+
+    /**
+     * Computes (and resizes) the element matrix \p Ke for \p elem.
+     */
+    virtual void elem_matrix (const Elem & elem,
+                              DenseMatrix<T> & Ke) = 0;
+  };
+
+  /**
+   * Constructor; takes references to the \p System whose operator
+   * this matrix represents and to the element kernel.  Both have to
+   * be stored elsewhere.
+   */
+  MatrixFreeShellMatrix (const System & sys,
+                         ElementKernel & kernel);
+
+  /**
+   * Destructor.
+   */
+  virtual ~MatrixFreeShellMatrix ();
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<T> & dest,
+                            const NumericVector<T> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<T> & dest,
+                                const NumericVector<T> & arg) const override;
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+  /**
+   * Releases the internal work vector.  Call this after the mesh or
+   * the dof distribution has changed; the work vector is rebuilt on
+   * the next operator application.
+   */
+  virtual void clear () override;
+
+protected:
+  /**
+   * The \p System whose operator we apply.
+   */
+  const System & _sys;
+
+  /**
+   * The element kernel.
+   */
+  ElementKernel & _kernel;
+
+  /**
+   * Ghosted work vector holding the localized argument, so the
+   * element products can be formed without further communication.
+   * Built lazily and reused across applications.
+   */
+  mutable std::unique_ptr<NumericVector<T>> _arg_ghosted;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_MATRIX_FREE_SHELL_MATRIX_H
@@ -463,6 +463,17 @@ public:
    */
   virtual void add (const T a, const NumericVector<T> & v) = 0;
 
+  /**
+   * Fused multi-axpy,
+   * \f$ \vec{u} \leftarrow \vec{u} + \sum_i a_i \vec{v}_i \f$.
+   * Backends which can will update the result in a single sweep over
+   * memory rather than one per term, so long sequences of add() calls
+   * in e.g. time integrators stay memory-bandwidth-bound on one pass.
+   * The default implementation simply loops over add().
+   */
+  virtual void add_vectors (const std::vector<T> & a,
+                            const std::vector<const NumericVector<T> *> & v);
+
   /**
    * Computes \f$ \vec{u} \leftarrow \vec{u} + \vec{v} \f$,
    * where \p v is a pointer and each \p dof_indices[i] specifies where
@@ -520,6 +531,35 @@ public:
   virtual void add_vector_transpose (const NumericVector<T> & v,
                                      const SparseMatrix<T> & A) = 0;
 
+  /**
+   * Records the additions \f$ u_i \leftarrow u_i + v_i \f$ in a
+   * buffer local to the calling thread instead of applying them
+   * immediately, so concurrently assembling threads never contend
+   * for the underlying vector.  The buffered contributions are not
+   * visible until the same thread calls flush_staged_adds().
+   */
+  void stage_add_vector (const T * v,
+                         const std::vector<numeric_index_type> & dof_indices);
+
+  /**
+   * Stages the addition of each entry of \p v, where \p v is a
+   * DenseVector and each \p dof_indices[i] specifies where to stage
+   * value \p v(i).
+   */
+  void stage_add_vector (const DenseVector<T> & v,
+                         const std::vector<numeric_index_type> & dof_indices);
+
+  /**
+   * Applies every addition the calling thread has staged with
+   * stage_add_vector() in a single add_vector() batch, sorted by
+   * index with duplicate contributions combined, then clears the
+   * thread's buffer.  Like add_vector() itself this is not
+   * thread-safe, so the caller must provide whatever synchronization
+   * the backend requires -- but only around this one call per batch
+   * rather than around every element contribution.
+   */
+  void flush_staged_adds ();
+
   /**
    * Inserts the entries of \p v in *this at the locations specified by \p v.
    */
@@ -568,6 +608,16 @@ public:
    */
   virtual T dot(const NumericVector<T> & v) const = 0;
 
+  /**
+   * Batched dot products: fills \p results with
+   * \f$ \vec{u} \cdot \vec{v}_i \f$ for each vector in \p v.
+   * Parallel backends which can combine the reductions pay for a
+   * single allreduce instead of one per product.  The default
+   * implementation simply loops over dot().
+   */
+  virtual void dot_vectors (const std::vector<const NumericVector<T> *> & v,
+                            std::vector<T> & results) const;
+
   /**
    * Creates a copy of the global vector in the local vector \p
    * v_local.
@@ -698,6 +748,31 @@ public:
     libmesh_not_implemented();
   }
 
+  /**
+   * Write the contents of the vector to the file named \p filename in
+   * the linear solver package's native binary format, using collective
+   * parallel I/O where the package supports it.  This is the vector
+   * counterpart of \p SparseMatrix::print_petsc_binary(), so an
+   * assembled matrix and its right-hand side can be dumped together
+   * for offline solver tuning.
+   */
+  virtual void print_petsc_binary(const std::string & /*filename*/) const
+  {
+    libmesh_not_implemented();
+  }
+
+  /**
+   * Read the contents of the vector from the file named \p filename,
+   * as written by \p print_petsc_binary().  If the vector has already
+   * been initialized its parallel decomposition is retained, so
+   * restoring on the original partitioning reproduces the original
+   * dof layout.
+   */
+  virtual void read_petsc_binary(const std::string & /*filename*/)
+  {
+    libmesh_not_implemented();
+  }
+
   /**
    * Fills in \p subvector from this vector using the indices in \p
    * rows.  Similar to the \p create_submatrix() routine for the
@@ -882,6 +957,18 @@ void NumericVector<T>::add_vector(const DenseVector<T> & v,
 
 
 
+template <typename T>
+inline
+void NumericVector<T>::stage_add_vector(const DenseVector<T> & v,
+                                        const std::vector<numeric_index_type> & dof_indices)
+{
+  libmesh_assert(v.size() == dof_indices.size());
+  if (!v.empty())
+    this->stage_add_vector(&v(0), dof_indices);
+}
+
+
+
 template <typename T>
 inline
 void NumericVector<T>::insert(const std::vector<T> & v,
@@ -104,6 +104,40 @@ public:
                             const Point & p,
                             Real time) override;
 
+  virtual void operator() (const std::vector<Point> & points,
+                           const Real time,
+                           std::vector<Output> & output) override;
+
+  virtual void component (unsigned int i,
+                          const std::vector<Point> & points,
+                          Real time,
+                          std::vector<Output> & output) override;
+
+  /**
+   * Evaluates component \p i at every entry of \p points in a single
+   * call, writing the values into \p output.  The time and any
+   * additional variables are marshalled once rather than per point,
+   * so this is the preferred way to evaluate a parsed coefficient at
+   * a whole quadrature rule's worth of points at a time, e.g. at the
+   * physical points returned by \p FEBase::get_xyz() during assembly.
+   */
+  void batch_eval (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<Output> & output,
+                   unsigned int i = 0);
+
+  /**
+   * Attempts to JIT compile every subexpression parser, so that
+   * subsequent evaluations dispatch to compiled kernels rather than
+   * the fparser bytecode interpreter.
+   *
+   * \returns \p true if every parser compiled successfully, \p false
+   * otherwise; in particular, always \p false when libMesh was built
+   * without fparser JIT support, in which case evaluation falls back
+   * to the (optimized) bytecode unharmed.
+   */
+  bool jit_compile ();
+
   const std::string & expression() { return _expression; }
 
   /**
@@ -350,6 +384,74 @@ ParsedFunction<Output,OutputGradient>::component (unsigned int i,
   return eval(*parsers[i], "f", i);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::operator() (const std::vector<Point> & points,
+                                                   const Real time,
+                                                   std::vector<Output> & output)
+{
+  this->batch_eval(points, time, output);
+}
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::component (unsigned int i,
+                                                  const std::vector<Point> & points,
+                                                  Real time,
+                                                  std::vector<Output> & output)
+{
+  this->batch_eval(points, time, output, i);
+}
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::batch_eval (const std::vector<Point> & points,
+                                                   const Real time,
+                                                   std::vector<Output> & output,
+                                                   unsigned int i)
+{
+  libmesh_assert_less (i, parsers.size());
+
+  output.resize(points.size());
+
+  // The time and any additional variables are loop invariant; only
+  // the spatial entries of _spacetime change from point to point.
+  _spacetime[LIBMESH_DIM] = time;
+
+  FunctionParserADBase<Output> & parser = *parsers[i];
+
+  for (auto qp : index_range(points))
+    {
+      const Point & p = points[qp];
+
+      _spacetime[0] = p(0);
+#if LIBMESH_DIM > 1
+      _spacetime[1] = p(1);
+#endif
+#if LIBMESH_DIM > 2
+      _spacetime[2] = p(2);
+#endif
+
+      output[qp] = eval(parser, "f", i);
+    }
+}
+
+template <typename Output, typename OutputGradient>
+inline
+bool
+ParsedFunction<Output,OutputGradient>::jit_compile ()
+{
+  bool success = true;
+
+  for (auto & parser : parsers)
+    success = parser->JITCompile() && success;
+
+  return success;
+}
+
 /**
  * \returns The address of a parsed variable so you can supply a parameterized value
  */
@@ -0,0 +1,199 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PETSC_EIGEN_VIEWS_H
+#define LIBMESH_PETSC_EIGEN_VIEWS_H
+
+#include "libmesh/libmesh_common.h"
+
+#if defined(LIBMESH_HAVE_PETSC) && defined(LIBMESH_HAVE_EIGEN)
+
+// Local includes
+#include "libmesh/eigen_core_support.h"
+#include "libmesh/eigen_sparse_vector.h"
+#include "libmesh/petsc_vector.h"
+#include "libmesh/petsc_macro.h"
+#include "libmesh/wrapped_petsc.h"
+
+namespace libMesh
+{
+
+/**
+ * A zero-copy Eigen view of the local values of a PetscVector.  The
+ * constructor checks out the raw PETSc data array (VecGetArray via
+ * PetscVector::get_array()) and wraps it in an Eigen::Map; the
+ * destructor restores the array.  No values are copied in either
+ * direction - writes through the map land directly in the PETSc
+ * vector.
+ *
+ * While the view is alive the underlying PetscVector must not be used
+ * through any other interface, per the get_array() contract, and must
+ * not be resized or destroyed.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief Eigen::Map over a PetscVector's local array.
+ */
+template <typename T>
+class PetscVectorEigenView
+{
+public:
+  typedef Eigen::Matrix<PetscScalar, Eigen::Dynamic, 1> storage_type;
+  typedef Eigen::Map<storage_type> map_type;
+
+  /**
+   * Constructor.  Checks out the data array of \p vec for read/write
+   * access.
+   */
+  explicit
+  PetscVectorEigenView (PetscVector<T> & vec) :
+    _vec(vec),
+    _map(vec.get_array(),
+         static_cast<eigen_idx_type>(vec.local_size()))
+  {}
+
+  /**
+   * Destructor.  Restores the data array.
+   */
+  ~PetscVectorEigenView () { _vec.restore_array(); }
+
+  /**
+   * This class checks out a raw array; it can't be copied.
+   */
+  PetscVectorEigenView (const PetscVectorEigenView &) = delete;
+  PetscVectorEigenView & operator= (const PetscVectorEigenView &) = delete;
+
+  /**
+   * \returns The Eigen view of the local values.
+   */
+  map_type & map () { return _map; }
+
+private:
+  PetscVector<T> & _vec;
+  map_type _map;
+};
+
+
+/**
+ * The read-only counterpart of PetscVectorEigenView, built on
+ * VecGetArrayRead via PetscVector::get_array_read().
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief Const Eigen::Map over a PetscVector's local array.
+ */
+template <typename T>
+class PetscVectorConstEigenView
+{
+public:
+  typedef Eigen::Matrix<PetscScalar, Eigen::Dynamic, 1> storage_type;
+  typedef Eigen::Map<const storage_type> map_type;
+
+  /**
+   * Constructor.  Checks out the data array of \p vec for read
+   * access.
+   */
+  explicit
+  PetscVectorConstEigenView (const PetscVector<T> & vec) :
+    _vec(vec),
+    _map(vec.get_array_read(),
+         static_cast<eigen_idx_type>(vec.local_size()))
+  {}
+
+  /**
+   * Destructor.  Restores the data array.
+   */
+  ~PetscVectorConstEigenView ()
+  {
+    // restore_array() doesn't modify values after a read-only
+    // checkout; it just returns the array to PETSc.
+    const_cast<PetscVector<T> &>(_vec).restore_array();
+  }
+
+  /**
+   * This class checks out a raw array; it can't be copied.
+   */
+  PetscVectorConstEigenView (const PetscVectorConstEigenView &) = delete;
+  PetscVectorConstEigenView & operator= (const PetscVectorConstEigenView &) = delete;
+
+  /**
+   * \returns The read-only Eigen view of the local values.
+   */
+  const map_type & map () const { return _map; }
+
+private:
+  const PetscVector<T> & _vec;
+  map_type _map;
+};
+
+
+/**
+ * A zero-copy PETSc Vec view of an EigenSparseVector's storage, built
+ * with VecCreateMPIWithArray so the Vec aliases the Eigen data
+ * instead of copying it.  The Vec is destroyed (but the Eigen storage
+ * untouched) when the view goes out of scope.
+ *
+ * While the view is alive the EigenSparseVector must not be resized
+ * or destroyed; writes through either interface are visible through
+ * the other.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief PETSc Vec aliasing an EigenSparseVector's storage.
+ */
+template <typename T>
+class EigenVectorPetscView
+{
+public:
+  /**
+   * Constructor.  Wraps the storage of \p vec in a PETSc Vec.  An
+   * EigenSparseVector is serial - each processor holds the whole
+   * vector - so the aliasing Vec lives on PETSC_COMM_SELF.
+   */
+  explicit
+  EigenVectorPetscView (EigenSparseVector<T> & vec)
+  {
+    PetscErrorCode ierr = VecCreateMPIWithArray
+      (PETSC_COMM_SELF, /*bs=*/1,
+       cast_int<PetscInt>(vec.local_size()),
+       cast_int<PetscInt>(vec.size()),
+       pPS(vec.vec().data()),
+       _petsc_vec.get());
+    CHKERRABORT(vec.comm().get(), ierr);
+  }
+
+  /**
+   * This class hands out an aliasing Vec; it can't be copied.
+   */
+  EigenVectorPetscView (const EigenVectorPetscView &) = delete;
+  EigenVectorPetscView & operator= (const EigenVectorPetscView &) = delete;
+
+  /**
+   * \returns The PETSc Vec aliasing the Eigen storage.
+   */
+  Vec vec () { return _petsc_vec; }
+
+private:
+  WrappedPetsc<Vec> _petsc_vec;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_PETSC && LIBMESH_HAVE_EIGEN
+#endif // LIBMESH_PETSC_EIGEN_VIEWS_H
@@ -179,6 +179,10 @@ public:
 
   virtual void flush () override;
 
+  virtual void flush_begin () override;
+
+  virtual void flush_end () override;
+
   virtual numeric_index_type m () const override;
 
   numeric_index_type local_m () const final;
@@ -262,6 +266,12 @@ public:
 
   virtual bool closed() const override;
 
+  /**
+   * \returns This processor's share of the matrix storage in bytes,
+   * as reported by \p MatGetInfo().
+   */
+  virtual std::size_t memory_footprint () const override;
+
   /**
    * If set to false, we don't delete the Mat on destruction and allow
    * instead for \p PETSc to manage it.
@@ -278,6 +288,10 @@ public:
 
   virtual void print_matlab(const std::string & name = "") const override;
 
+  virtual void print_petsc_binary(const std::string & filename) const override;
+
+  virtual void read_petsc_binary(const std::string & filename) override;
+
   virtual void get_diagonal (NumericVector<T> & dest) const override;
 
   virtual void get_transpose (SparseMatrix<T> & dest) const override;
@@ -301,6 +315,34 @@ public:
   void get_row(numeric_index_type i,
                std::vector<numeric_index_type> & indices,
                std::vector<T> & values) const override;
+
+  /**
+   * Enables or disables coordinate-format (COO) staging of add() and
+   * add_matrix() contributions.  With staging enabled, contributions
+   * are appended to a local triplet buffer instead of being handed to
+   * \p MatSetValues() immediately; the buffer is sorted by row,
+   * duplicates are merged, and each row is inserted in one bulk call
+   * when the matrix is closed or flushed.  This decouples assembly
+   * order from insertion order and replaces one sparsity-pattern
+   * search per entry with a single sorted pass per row, which pays
+   * off for high-order elements whose entries are revisited many
+   * times during assembly.
+   */
+  void set_coo_staging (bool enabled);
+
+  /**
+   * \returns Whether add() and add_matrix() contributions are being
+   * staged in coordinate format.
+   */
+  bool coo_staging () const { return _coo_staging; }
+
+  /**
+   * Sorts, merges, and inserts any staged coordinate-format
+   * contributions into the PETSc matrix.  Called automatically by
+   * close() and flush().
+   */
+  void flush_coo_staging ();
+
 protected:
 
   /**
@@ -333,6 +375,21 @@ private:
 
   PetscMatrixType _mat_type;
 
+  /**
+   * Whether add() and add_matrix() contributions are staged in
+   * coordinate format rather than inserted immediately.
+   */
+  bool _coo_staging;
+
+  /**
+   * The staged coordinate-format triplets.  Appends are guarded by
+   * \p _petsc_matrix_mutex, so threaded assembly may stage
+   * contributions concurrently.
+   */
+  std::vector<PetscInt> _coo_rows;
+  std::vector<PetscInt> _coo_cols;
+  std::vector<PetscScalar> _coo_vals;
+
 #ifdef LIBMESH_HAVE_CXX11_THREAD
   mutable std::mutex _petsc_matrix_mutex;
 #else
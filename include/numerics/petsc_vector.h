@@ -33,6 +33,8 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/petsc_solver_exception.h"
 #include "libmesh/parallel_only.h"
+#include "libmesh/threads.h"
+#include "libmesh/wrapped_petsc.h"
 
 // PETSc include files.
 #ifdef I
@@ -248,6 +250,12 @@ public:
 
   virtual void add (const T a, const NumericVector<T> & v) override;
 
+  /**
+   * Fused multi-axpy via a single VecMAXPY() call.
+   */
+  virtual void add_vectors (const std::vector<T> & a,
+                            const std::vector<const NumericVector<T> *> & v) override;
+
   /**
    * We override two NumericVector<T>::add_vector() methods but don't
    * want to hide the other defaults.
@@ -291,6 +299,13 @@ public:
 
   virtual T dot(const NumericVector<T> & v) const override;
 
+  /**
+   * Batched dot products via a single VecMDot() call, which combines
+   * the parallel reductions into one allreduce.
+   */
+  virtual void dot_vectors (const std::vector<const NumericVector<T> *> & v,
+                            std::vector<T> & results) const override;
+
   /**
    * \returns The dot product of (*this) with the vector \p v.
    *
@@ -320,6 +335,10 @@ public:
 
   virtual void print_matlab(const std::string & name = "") const override;
 
+  virtual void print_petsc_binary(const std::string & filename) const override;
+
+  virtual void read_petsc_binary(const std::string & filename) override;
+
   virtual void create_subvector(NumericVector<T> & subvector,
                                 const std::vector<numeric_index_type> & rows) const override;
 
@@ -347,6 +366,19 @@ private:
    */
   Vec _vec;
 
+  /**
+   * Scatter context, index list, and destination layout cached by \p
+   * localize(v_local, send_list), so that repeated localizations with
+   * an unchanged send list -- e.g. \p System::update() every timestep
+   * -- reuse one persistent VecScatter instead of rebuilding it on
+   * each call.  A scatter may be applied to any vectors matching the
+   * layouts it was created with, so we key on layouts rather than on
+   * Vec identities.  Invalidated by \p clear().
+   */
+  mutable WrappedPetsc<VecScatter> _localize_scatter;
+  mutable std::vector<PetscInt> _localize_indices;
+  mutable PetscInt _localize_dest_local_size = -1;
+
   /**
    * If \p true, the actual PETSc array of the values of the vector is
    * currently accessible.  That means that the members \p _local_form
@@ -691,7 +723,33 @@ void PetscVector<T>::init (const numeric_index_type n,
 
 
   if (fast == false)
-    this->zero ();
+    {
+      // Freshly allocated PETSc storage is untouched, so on NUMA
+      // machines its physical pages land on the socket of whichever
+      // thread first writes them.  When thread pinning is active we
+      // zero in parallel, using the same static partition later
+      // threaded loops see, instead of letting one thread place every
+      // page on its own socket.
+      if (Threads::pin_threads && libMesh::n_threads() > 1)
+        {
+          PetscScalar * values;
+          ierr = VecGetArray (_vec, &values);
+          LIBMESH_CHKERR(ierr);
+
+          Threads::parallel_for
+            (Threads::BlockedRange<numeric_index_type>(0, n_local),
+             [values](const Threads::BlockedRange<numeric_index_type> & range)
+             {
+               for (numeric_index_type i=range.begin(); i!=range.end(); ++i)
+                 values[i] = 0.;
+             });
+
+          ierr = VecRestoreArray (_vec, &values);
+          LIBMESH_CHKERR(ierr);
+        }
+      else
+        this->zero ();
+    }
 }
 
 
@@ -846,6 +904,10 @@ void PetscVector<T>::clear ()
   this->_is_closed = this->_is_initialized = false;
 
   _global_to_local_map.clear();
+
+  _localize_scatter.reset_to_zero();
+  _localize_indices.clear();
+  _localize_dest_local_size = -1;
 }
 
 
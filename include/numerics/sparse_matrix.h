@@ -214,6 +214,22 @@ public:
    */
   virtual void flush () { close(); }
 
+  /**
+   * Starts communicating any accumulated off-processor entries
+   * without finalizing the matrix, so callers can overlap further
+   * processor-local insertions with the communication.  Each
+   * flush_begin() must be matched by a flush_end(), and only entries
+   * in locally owned rows may be added between the two calls.
+   * Implementations without split-phase support may defer all the
+   * work to flush_end().
+   */
+  virtual void flush_begin () {}
+
+  /**
+   * Completes the communication started by \p flush_begin().
+   */
+  virtual void flush_end () { this->flush(); }
+
   /**
    * \returns The row-dimension of the matrix.
    */
@@ -349,6 +365,14 @@ public:
    */
   virtual bool closed() const = 0;
 
+  /**
+   * \returns An estimate, in bytes, of the memory occupied on this
+   * processor by the matrix storage, or zero for backends which
+   * cannot report one.  This is intended for instrumentation at
+   * phase boundaries, not for exact accounting.
+   */
+  virtual std::size_t memory_footprint () const { return 0; }
+
   /**
    * Print the contents of the matrix to the screen in a uniform
    * style, regardless of matrix/solver package being used.
@@ -400,6 +424,32 @@ public:
     libmesh_not_implemented();
   }
 
+  /**
+   * Write the contents of the matrix to the file named \p filename in
+   * the linear solver package's native binary format, using collective
+   * parallel I/O where the package supports it.  Unlike \p
+   * print_matlab(), this is intended to be cheap enough to leave
+   * enabled in production runs, so assembled systems can be dumped for
+   * offline solver tuning and restored with \p read_petsc_binary().
+   */
+  virtual void print_petsc_binary(const std::string & /*filename*/) const
+  {
+    libmesh_not_implemented();
+  }
+
+  /**
+   * Read the contents of the matrix from the file named \p filename,
+   * as written by \p print_petsc_binary().  If the matrix has already
+   * been initialized - e.g. with the sparsity pattern and parallel
+   * decomposition of a \p DofMap - that decomposition is retained, so
+   * restoring on the original partitioning reproduces the original
+   * dof layout.
+   */
+  virtual void read_petsc_binary(const std::string & /*filename*/)
+  {
+    libmesh_not_implemented();
+  }
+
   /**
    * This function creates a matrix called "submatrix" which is defined
    * by the row and column indices given in the "rows" and "cols" entries.
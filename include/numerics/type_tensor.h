@@ -223,6 +223,24 @@ public:
   template <typename T2>
   void add_scaled (const TypeTensor<T2> &, const T &);
 
+  /**
+   * Add a scaled outer product of two vectors to this tensor without
+   * creating a temporary tensor, i.e.
+   * `*this += factor * outer_product(a, b)`.  As in outer_product(),
+   * the entries of \p b are conjugated.
+   */
+  template <typename T2>
+  void add_scaled_outer_product (const TypeVector<T2> & a,
+                                 const TypeVector<T2> & b,
+                                 const T & factor);
+
+  /**
+   * Add a scaled transpose to this tensor without creating a
+   * temporary for the transpose, i.e. `*this += factor * p.transpose()`.
+   */
+  template <typename T2>
+  void add_scaled_transpose (const TypeTensor<T2> & p, const T & factor);
+
   /**
    * Subtract a tensor from this tensor.
    *
@@ -852,6 +870,50 @@ void TypeTensor<T>::add_scaled (const TypeTensor<T2> & p, const T & factor)
 
 
 
+template <typename T>
+template <typename T2>
+inline
+void TypeTensor<T>::add_scaled_outer_product (const TypeVector<T2> & a,
+                                              const TypeVector<T2> & b,
+                                              const T & factor)
+{
+  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+    for (unsigned int j=0; j<LIBMESH_DIM; j++)
+      _coords[i*LIBMESH_DIM+j] += factor * a(i) * libmesh_conj(b(j));
+}
+
+
+
+template <typename T>
+template <typename T2>
+inline
+void TypeTensor<T>::add_scaled_transpose (const TypeTensor<T2> & p, const T & factor)
+{
+  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+    for (unsigned int j=0; j<LIBMESH_DIM; j++)
+      _coords[i*LIBMESH_DIM+j] += factor*p._coords[j*LIBMESH_DIM+i];
+}
+
+
+
+template <typename T>
+template <typename T2>
+inline
+void TypeVector<T>::add_scaled_product (const TypeTensor<T2> & A,
+                                        const TypeVector<T2> & x,
+                                        const T & factor)
+{
+  for (unsigned int i=0; i<LIBMESH_DIM; i++)
+    {
+      T acc = 0;
+      for (unsigned int j=0; j<LIBMESH_DIM; j++)
+        acc += A(i,j) * x(j);
+      (*this)(i) += factor * acc;
+    }
+}
+
+
+
 template <typename T>
 template<typename T2>
 inline
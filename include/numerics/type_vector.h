@@ -229,6 +229,17 @@ public:
   template <typename T2>
   void add_scaled (const TypeVector<T2> &, const T &);
 
+  /**
+   * Add a scaled matrix-vector product to this vector without
+   * creating a temporary for the intermediate product, i.e.
+   * `*this += factor * (A * x)`.  The definition lives in
+   * type_tensor.h, where TypeTensor is complete.
+   */
+  template <typename T2>
+  void add_scaled_product (const TypeTensor<T2> & A,
+                           const TypeVector<T2> & x,
+                           const T & factor);
+
   /**
    * Subtract from this vector.
    *
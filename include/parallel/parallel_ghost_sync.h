@@ -23,16 +23,23 @@
 // libMesh includes
 #include "libmesh/elem.h"
 #include "libmesh/int_range.h"
+#include "libmesh/libmesh_call_mpi.h"
 #include "libmesh/location_maps.h"
 #include "libmesh/mesh_base.h"
 #include "libmesh/parallel_algebra.h"
+#include "libmesh/threads.h"
+#include "libmesh/utility.h" // libmesh_map_find
 
 // TIMPI includes
 #include "timpi/communicator.h"
 #include "timpi/parallel_sync.h"
 
 // C++ includes
+#include <algorithm>
 #include <map> // FIXME - pid > comm.size() breaks with unordered_map
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -232,6 +239,390 @@ struct SyncEverything
 
 
 
+/**
+ * Functor which aggregates two sync functors acting on the same
+ * range of objects into a single pass, so that what would have been
+ * back-to-back sync_dofobject_data_by_id() calls -- each a separate
+ * latency-bound communication round -- become one combined
+ * pack/exchange/unpack with a single set of messages.  The combined
+ * datum travels as a std::pair, for which TIMPI provides a
+ * StandardType whenever both component types have one.  Pairs nest,
+ * so any number of syncs over the same range can be aggregated:
+ *
+ * \code
+ * auto sync_ab  = Parallel::make_paired_sync(sync_a, sync_b);
+ * auto sync_abc = Parallel::make_paired_sync(sync_ab, sync_c);
+ * Parallel::sync_dofobject_data_by_id
+ *   (mesh.comm(), range_begin, range_end, sync_abc);
+ * \endcode
+ *
+ * Each component functor sees exactly the id vectors it would have
+ * seen in its own separate pass over the same range.
+ */
+template <typename SyncA, typename SyncB>
+struct PairedSync
+{
+  typedef std::pair<typename SyncA::datum, typename SyncB::datum> datum;
+
+  PairedSync(SyncA & a, SyncB & b) : sync_a(a), sync_b(b) {}
+
+  void gather_data (const std::vector<dof_id_type> & ids,
+                    std::vector<datum> & data) const
+  {
+    std::vector<typename SyncA::datum> data_a;
+    std::vector<typename SyncB::datum> data_b;
+
+    sync_a.gather_data(ids, data_a);
+    sync_b.gather_data(ids, data_b);
+
+    libmesh_assert_equal_to (data_a.size(), ids.size());
+    libmesh_assert_equal_to (data_b.size(), ids.size());
+
+    data.resize(ids.size());
+    for (auto i : index_range(ids))
+      data[i] = std::make_pair(data_a[i], data_b[i]);
+  }
+
+  void act_on_data (const std::vector<dof_id_type> & ids,
+                    const std::vector<datum> & data) const
+  {
+    std::vector<typename SyncA::datum> data_a(ids.size());
+    std::vector<typename SyncB::datum> data_b(ids.size());
+
+    for (auto i : index_range(ids))
+      {
+        data_a[i] = data[i].first;
+        data_b[i] = data[i].second;
+      }
+
+    sync_a.act_on_data(ids, data_a);
+    sync_b.act_on_data(ids, data_b);
+  }
+
+  SyncA & sync_a;
+  SyncB & sync_b;
+};
+
+
+
+/**
+ * \returns A PairedSync combining \p a and \p b, with the component
+ * types deduced.
+ */
+template <typename SyncA, typename SyncB>
+PairedSync<SyncA, SyncB> make_paired_sync(SyncA & a, SyncB & b)
+{
+  return PairedSync<SyncA, SyncB>(a, b);
+}
+
+
+
+//------------------------------------------------------------------------
+// Intra-node shared-memory fast path for ghost data pulls.
+//
+// Ranks sharing a compute node can answer each other's ghost requests
+// through an MPI-3 shared window with plain loads and stores, skipping
+// message packing and matching entirely; only inter-node requests then
+// need the message-based pull_parallel_vector_data() path.
+#if defined(LIBMESH_HAVE_MPI) && (MPI_VERSION > 2)
+
+/**
+ * The shared-memory layout of one Communicator: the node-local
+ * subcommunicator produced by MPI_Comm_split_type, our rank and the
+ * node's size within it, and a map from global processor ids back to
+ * node ranks for the processors that share our node.  Built once per
+ * communicator and cached by node_group().
+ */
+class NodeGroup
+{
+public:
+  explicit NodeGroup (const Communicator & comm) :
+    node_comm(MPI_COMM_NULL)
+  {
+    libmesh_call_mpi
+      (MPI_Comm_split_type (comm.get(), MPI_COMM_TYPE_SHARED,
+                            comm.rank(), MPI_INFO_NULL, &node_comm));
+
+    int rank, size;
+    libmesh_call_mpi (MPI_Comm_rank (node_comm, &rank));
+    libmesh_call_mpi (MPI_Comm_size (node_comm, &size));
+    node_rank = cast_int<processor_id_type>(rank);
+    node_size = cast_int<processor_id_type>(size);
+
+    // Learn which global rank sits at each node rank
+    std::vector<unsigned int> global_ranks(node_size);
+    unsigned int my_global_rank = comm.rank();
+    libmesh_call_mpi
+      (MPI_Allgather (&my_global_rank, 1, MPI_UNSIGNED,
+                      global_ranks.data(), 1, MPI_UNSIGNED,
+                      node_comm));
+
+    for (processor_id_type nr = 0; nr != node_size; ++nr)
+      node_rank_of[cast_int<processor_id_type>(global_ranks[nr])] = nr;
+  }
+
+  NodeGroup (const NodeGroup &) = delete;
+  NodeGroup & operator= (const NodeGroup &) = delete;
+
+  ~NodeGroup ()
+  {
+    // If our communicator is never explicitly freed, the delete
+    // callback destroying us may not run until program exit; don't
+    // try to free communicators after MPI_Finalize.
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (!finalized && node_comm != MPI_COMM_NULL)
+      MPI_Comm_free (&node_comm);
+  }
+
+  MPI_Comm node_comm;
+  processor_id_type node_rank, node_size;
+
+  /**
+   * Global processor id -> rank within node_comm, for the processors
+   * sharing our node only.
+   */
+  std::unordered_map<processor_id_type, processor_id_type> node_rank_of;
+};
+
+
+/**
+ * Delete callback run by MPI when a communicator carrying a cached
+ * NodeGroup attribute is freed.
+ */
+inline
+int delete_node_group_attr (MPI_Comm, int, void * attr_val, void *)
+{
+  delete static_cast<NodeGroup *>(attr_val);
+  return MPI_SUCCESS;
+}
+
+
+/**
+ * \returns The cached NodeGroup of \p comm, splitting the
+ * communicator by node on first use.  The first call for any given
+ * communicator is collective over it.
+ *
+ * The group is cached on the communicator itself through an MPI
+ * attribute, so MPI destroys it when the communicator is freed; a
+ * later communicator reusing the same handle value can never observe
+ * a stale entry, which a process-global map keyed on the raw handle
+ * could not guarantee.
+ */
+inline
+const NodeGroup & node_group (const Communicator & comm)
+{
+  static int node_group_keyval = MPI_KEYVAL_INVALID;
+  static Threads::spin_mutex node_group_mtx;
+
+  Threads::spin_mutex::scoped_lock lock(node_group_mtx);
+
+  if (node_group_keyval == MPI_KEYVAL_INVALID)
+    libmesh_call_mpi
+      (MPI_Comm_create_keyval (MPI_COMM_NULL_COPY_FN,
+                               delete_node_group_attr,
+                               &node_group_keyval, nullptr));
+
+  void * attr_val;
+  int found;
+  libmesh_call_mpi
+    (MPI_Comm_get_attr (comm.get(), node_group_keyval, &attr_val, &found));
+  if (found)
+    return *static_cast<NodeGroup *>(attr_val);
+
+  NodeGroup * group = new NodeGroup(comm);
+  libmesh_call_mpi
+    (MPI_Comm_set_attr (comm.get(), node_group_keyval, group));
+  return *group;
+}
+
+
+/**
+ * Makes every node rank's stores to \p win visible to every other
+ * node rank's loads.
+ */
+inline
+void shared_window_sync (MPI_Win win, MPI_Comm node_comm)
+{
+  libmesh_call_mpi (MPI_Win_lock_all (MPI_MODE_NOCHECK, win));
+  libmesh_call_mpi (MPI_Win_sync (win));
+  libmesh_call_mpi (MPI_Barrier (node_comm));
+  libmesh_call_mpi (MPI_Win_sync (win));
+  libmesh_call_mpi (MPI_Win_unlock_all (win));
+}
+
+
+/**
+ * Serves the subset of \p requests addressed to processors on our own
+ * shared-memory node through a pair of MPI-3 shared windows:
+ * requesters publish their id lists in the first, owners gather and
+ * store answers straight into the requesters' segments of the second,
+ * and both directions are plain memcpys with no message packing or
+ * matching.  Served entries are erased from \p requests; whatever
+ * remains should go through pull_parallel_vector_data() as usual.
+ *
+ * This function must be run on all processors of \p comm at once.
+ *
+ * Only enabled for trivially copyable datum types; anything else (or
+ * any build without MPI-3 shared windows) falls through to the no-op
+ * overload below and keeps the full request map on the message path.
+ */
+template <typename SyncFunctor>
+typename std::enable_if<std::is_trivially_copyable<typename SyncFunctor::datum>::value, void>::type
+pull_node_local_data (const Communicator & comm,
+                      std::map<processor_id_type, std::vector<dof_id_type>> & requests,
+                      SyncFunctor & sync)
+{
+  typedef typename SyncFunctor::datum datum;
+
+  const NodeGroup & node = node_group(comm);
+
+  // If we're alone on our node then nothing can be node-local, and we
+  // can skip the collective window calls below on every node at once.
+  if (node.node_size == 1)
+    return;
+
+  // Which of our requests can be served on-node?
+  std::vector<processor_id_type> local_procs;
+  std::size_t total_ids = 0;
+  for (const auto & pr : requests)
+    if (node.node_rank_of.count(pr.first))
+      {
+        local_procs.push_back(pr.first);
+        total_ids += pr.second.size();
+      }
+
+  // Even a processor with nothing to ask on-node has to take part in
+  // the collective window calls, so no early return from here on.
+
+  // Our request segment, in dof_id_type units:
+  // [n_blocks][per block: owner node rank, n_ids, response offset]
+  // followed by all the id lists back to back.  Our response segment
+  // holds one datum per requested id, at the recorded offsets.
+  const std::size_t req_entries = 1 + 3*local_procs.size() + total_ids;
+
+  MPI_Win req_win, resp_win;
+  dof_id_type * req_base = nullptr;
+  datum * resp_base = nullptr;
+
+  libmesh_call_mpi
+    (MPI_Win_allocate_shared
+     (static_cast<MPI_Aint>(req_entries * sizeof(dof_id_type)),
+      sizeof(dof_id_type), MPI_INFO_NULL, node.node_comm,
+      &req_base, &req_win));
+  libmesh_call_mpi
+    (MPI_Win_allocate_shared
+     (static_cast<MPI_Aint>(total_ids * sizeof(datum)),
+      sizeof(datum), MPI_INFO_NULL, node.node_comm,
+      &resp_base, &resp_win));
+
+  // Publish our id lists
+  req_base[0] = cast_int<dof_id_type>(local_procs.size());
+  {
+    std::size_t header = 1;
+    std::size_t ids_offset = 1 + 3*local_procs.size();
+    std::size_t resp_offset = 0;
+    for (const auto p : local_procs)
+      {
+        const std::vector<dof_id_type> & ids = requests[p];
+        req_base[header++] = libmesh_map_find(node.node_rank_of, p);
+        req_base[header++] = cast_int<dof_id_type>(ids.size());
+        req_base[header++] = cast_int<dof_id_type>(resp_offset);
+        std::copy(ids.begin(), ids.end(), req_base + ids_offset);
+        ids_offset += ids.size();
+        resp_offset += ids.size();
+      }
+  }
+
+  shared_window_sync(req_win, node.node_comm);
+
+  // Serve every block addressed to us: gather locally, then store the
+  // answers straight into the requester's response segment.
+  {
+    std::vector<dof_id_type> ids;
+    std::vector<datum> data;
+    for (processor_id_type nr = 0; nr != node.node_size; ++nr)
+      {
+        if (nr == node.node_rank)
+          continue;
+
+        MPI_Aint seg_bytes;
+        int disp_unit;
+        void * base_ptr;
+        libmesh_call_mpi
+          (MPI_Win_shared_query (req_win, nr, &seg_bytes, &disp_unit, &base_ptr));
+        const dof_id_type * their_req =
+          static_cast<const dof_id_type *>(base_ptr);
+        libmesh_call_mpi
+          (MPI_Win_shared_query (resp_win, nr, &seg_bytes, &disp_unit, &base_ptr));
+        datum * their_resp = static_cast<datum *>(base_ptr);
+
+        const dof_id_type n_blocks = their_req[0];
+        std::size_t ids_offset = 1 + 3*static_cast<std::size_t>(n_blocks);
+        for (dof_id_type b = 0; b != n_blocks; ++b)
+          {
+            const dof_id_type owner_nr = their_req[1 + 3*b];
+            const dof_id_type n_ids    = their_req[2 + 3*b];
+            const dof_id_type resp_off = their_req[3 + 3*b];
+
+            if (owner_nr == node.node_rank)
+              {
+                ids.assign(their_req + ids_offset,
+                           their_req + ids_offset + n_ids);
+                data.clear();
+                sync.gather_data(ids, data);
+                libmesh_assert_equal_to (data.size(), ids.size());
+                std::copy(data.begin(), data.end(), their_resp + resp_off);
+              }
+            ids_offset += n_ids;
+          }
+      }
+  }
+
+  shared_window_sync(resp_win, node.node_comm);
+
+  // Our answers landed in our own segment, so reading them back is
+  // all local loads.  Act on them and drop the served requests.
+  {
+    std::vector<datum> data;
+    std::size_t resp_offset = 0;
+    for (const auto p : local_procs)
+      {
+        const std::vector<dof_id_type> & ids = requests[p];
+        data.assign(resp_base + resp_offset,
+                    resp_base + resp_offset + ids.size());
+        sync.act_on_data(ids, data);
+        resp_offset += ids.size();
+      }
+  }
+
+  libmesh_call_mpi (MPI_Win_free (&req_win));
+  libmesh_call_mpi (MPI_Win_free (&resp_win));
+
+  for (const auto p : local_procs)
+    requests.erase(p);
+}
+
+
+template <typename SyncFunctor>
+typename std::enable_if<!std::is_trivially_copyable<typename SyncFunctor::datum>::value, void>::type
+pull_node_local_data (const Communicator &,
+                      std::map<processor_id_type, std::vector<dof_id_type>> &,
+                      SyncFunctor &)
+{}
+
+#else // !LIBMESH_HAVE_MPI || MPI_VERSION <= 2
+
+template <typename SyncFunctor>
+void pull_node_local_data (const Communicator &,
+                           std::map<processor_id_type, std::vector<dof_id_type>> &,
+                           SyncFunctor &)
+{}
+
+#endif
+
+
+
 template <typename Iterator,
           typename DofObjType,
           typename SyncFunctor>
@@ -419,6 +810,11 @@ void sync_dofobject_data_by_id(const Communicator & comm,
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
+  // Requests to processors sharing our node go through a
+  // shared-memory window and get erased from the map; only inter-node
+  // requests (if any) pay for message traffic below.
+  pull_node_local_data (comm, requested_objs_id, sync);
+
   auto gather_functor =
     [&sync]
     (processor_id_type, const std::vector<dof_id_type> & ids,
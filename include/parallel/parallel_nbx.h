@@ -0,0 +1,199 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PARALLEL_NBX_H
+#define LIBMESH_PARALLEL_NBX_H
+
+// libMesh includes
+#include "libmesh/libmesh_call_mpi.h"
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel.h"
+#include "libmesh/parallel_only.h"
+
+// TIMPI includes
+#include "timpi/communicator.h"
+#include "timpi/parallel_sync.h"
+
+// C++ includes
+#include <map> // FIXME - pid > comm.size() breaks with unordered_map
+#include <vector>
+
+
+namespace libMesh
+{
+
+namespace Parallel {
+
+//--------------------------------------------------------------------------
+/**
+ * Exchange sparse per-processor data using the NBX (nonblocking
+ * consensus) algorithm of Hoefler, Siebert & Lumsdaine.
+ *
+ * Each (pid, vector) pair in \p data_to_send is shipped to processor
+ * \p pid with a synchronous nonblocking send, and every message that
+ * arrives here is handed to
+ * act_on_received(pid, const std::vector<T> & data).
+ * Once a processor's own sends have all been matched it enters a
+ * nonblocking barrier, servicing further incoming messages while the
+ * consensus completes.
+ *
+ * Unlike alltoall-style exchanges, no rank ever waits on a dense
+ * collective pattern: a processor with few (or no) communication
+ * partners does O(messages) work and proceeds immediately, which is
+ * what makes fundamentally sparse neighbor exchanges scale at large
+ * processor counts.
+ *
+ * The user must define Parallel::StandardType<T> if T isn't a
+ * built-in type.  Every key in \p data_to_send must be a valid
+ * processor id; data addressed to ourself is delivered locally,
+ * before any remote data.  Like all our sync primitives this must be
+ * called on all processors at once, but processors which neither send
+ * nor receive do not block.
+ */
+template <typename T, typename ActionFunctor>
+void nbx_exchange_vector_data (const Communicator & comm,
+                               const std::map<processor_id_type, std::vector<T>> & data_to_send,
+                               ActionFunctor & act_on_received)
+{
+  // This function must be run on all processors at once, but only
+  // communication partners synchronize with each other.
+  libmesh_parallel_only(comm);
+
+  // Anything addressed to ourself never touches the network.
+  {
+    typename std::map<processor_id_type, std::vector<T>>::const_iterator
+      self_data = data_to_send.find(comm.rank());
+    if (self_data != data_to_send.end())
+      act_on_received(comm.rank(), self_data->second);
+  }
+
+#if defined(LIBMESH_HAVE_MPI) && (MPI_VERSION > 2)
+
+  StandardType<T> datatype;
+
+  // A unique tag keeps our probes from matching messages belonging
+  // to any other exchange in flight on this communicator.
+  const MessageTag tag = comm.get_unique_tag();
+
+  // Synchronous nonblocking sends: each completes only once the
+  // receiver has begun matching it, which is what lets barrier
+  // completion certify that every message has found its recipient.
+  std::vector<MPI_Request> send_requests;
+  send_requests.reserve(data_to_send.size());
+
+  for (const auto & pr : data_to_send)
+    {
+      if (pr.first == comm.rank())
+        continue;
+
+      libmesh_assert_less (pr.first, comm.size());
+
+      send_requests.push_back(MPI_REQUEST_NULL);
+      libmesh_call_mpi
+        (MPI_Issend (pr.second.empty() ? nullptr : pr.second.data(),
+                     cast_int<int>(pr.second.size()), datatype,
+                     pr.first, tag.value(), comm.get(),
+                     &send_requests.back()));
+    }
+
+  bool sends_complete = send_requests.empty();
+  bool barrier_started = false;
+  MPI_Request barrier_request = MPI_REQUEST_NULL;
+
+  std::vector<T> incoming_data;
+
+  while (true)
+    {
+      // Service an incoming message if one has arrived.
+      int message_waiting = 0;
+      MPI_Status status;
+      libmesh_call_mpi
+        (MPI_Iprobe (MPI_ANY_SOURCE, tag.value(), comm.get(),
+                     &message_waiting, &status));
+
+      if (message_waiting)
+        {
+          int count = 0;
+          libmesh_call_mpi
+            (MPI_Get_count (&status, datatype, &count));
+
+          incoming_data.resize(count);
+          libmesh_call_mpi
+            (MPI_Recv (count ? incoming_data.data() : nullptr, count,
+                       datatype, status.MPI_SOURCE, tag.value(),
+                       comm.get(), MPI_STATUS_IGNORE));
+
+          act_on_received
+            (cast_int<processor_id_type>(status.MPI_SOURCE),
+             incoming_data);
+        }
+
+      if (!sends_complete)
+        {
+          int flag = 0;
+          libmesh_call_mpi
+            (MPI_Testall (cast_int<int>(send_requests.size()),
+                          send_requests.data(), &flag,
+                          MPI_STATUSES_IGNORE));
+          sends_complete = flag;
+        }
+      else if (!barrier_started)
+        {
+          // All our sends have been matched; join the consensus.  We
+          // keep probing for stragglers until everyone else has too.
+          libmesh_call_mpi
+            (MPI_Ibarrier (comm.get(), &barrier_request));
+          barrier_started = true;
+        }
+      else
+        {
+          int flag = 0;
+          libmesh_call_mpi
+            (MPI_Test (&barrier_request, &flag, MPI_STATUS_IGNORE));
+          if (flag)
+            break;
+        }
+    }
+
+#elif defined(LIBMESH_HAVE_MPI)
+
+  // An MPI too old for MPI_Ibarrier; fall back to the alltoall-based
+  // exchange, skipping the self-send we already delivered.
+  std::map<processor_id_type, std::vector<T>> remote_data(data_to_send);
+  remote_data.erase(comm.rank());
+
+  push_parallel_vector_data (comm, remote_data, act_on_received);
+
+#else
+
+  // Without MPI the self-delivery above was the whole exchange.
+  libmesh_assert (data_to_send.empty() ||
+                  (data_to_send.size() == 1 &&
+                   data_to_send.begin()->first == comm.rank()));
+
+#endif
+}
+
+
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_PARALLEL_NBX_H
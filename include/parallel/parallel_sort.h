@@ -59,9 +59,9 @@ public:
    * Constructor takes the number of processors,
    * the processor id, and a reference to a vector of data
    * to be sorted.  This vector is sorted by
-   * the constructor, therefore, construction of
-   * a Sort object takes O(n log n) time,
-   * where n is the length of the vector.
+   * the constructor - with an O(n) radix sort for
+   * integer key types, and with std::sort(),
+   * taking O(n log n) time, otherwise.
    */
   Sort (const Parallel::Communicator & comm,
         std::vector<KeyType> & d);
@@ -82,6 +82,18 @@ public:
    */
   const std::vector<KeyType> & bin();
 
+  /**
+   * Selects the single-round sample sort algorithm in place of the
+   * default histogram-refinement bin sort.  Sample sort computes the
+   * bin splitters from a sampling of the locally sorted data with a
+   * single allgather, so the number of communication rounds is fixed
+   * regardless of processor count, at the cost of bins which are only
+   * approximately balanced.  This is a good trade at large processor
+   * counts whenever the key distribution is benign, i.e. without
+   * large numbers of duplicate keys.
+   */
+  void use_sample_sort (bool use_it) { _use_sample_sort = use_it; }
+
 private:
 
   /**
@@ -99,6 +111,12 @@ private:
    */
   bool _bin_is_sorted;
 
+  /**
+   * Flag which selects the sample sort algorithm over the
+   * default bin sort.
+   */
+  bool _use_sample_sort;
+
   /**
    * The raw, unsorted data which will need to
    * be sorted (in parallel) across all
@@ -128,6 +146,13 @@ private:
    */
   void binsort ();
 
+  /**
+   * Computes the local bin sizes from splitters sampled out of the
+   * sorted local data, using a single allgather instead of the
+   * histogram refinement loop in binsort().
+   */
+  void samplesort ();
+
   /**
    * Communicates the bins from each processor to the
    * appropriate processor.  By the time this function
@@ -0,0 +1,253 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_SHARED_MEMORY_ARRAY_H
+#define LIBMESH_SHARED_MEMORY_ARRAY_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/libmesh_call_mpi.h"
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace libMesh
+{
+
+namespace Parallel
+{
+
+/**
+ * An array of trivially-copyable entries stored once per shared-memory
+ * node rather than once per processor.  The lowest-ranked processor on
+ * each node (the "writer") allocates the backing segment via an MPI-3
+ * shared window, fills it, and calls \p synchronize(); every other
+ * processor on that node then reads the same physical pages through \p
+ * data(), so replicating N entries across P ranks-per-node costs one
+ * copy per node instead of P.
+ *
+ * This is the building block for de-duplicating bulk read-only data
+ * that is replicated on every processor - cached index tables, lookup
+ * arrays, serialized mesh data - without changing its consumers, which
+ * see an ordinary const array.  Typical usage:
+ *
+ * \code
+ * SharedMemoryArray<Real> table(comm, n_entries);
+ * if (table.is_writer())
+ *   for (std::size_t i = 0; i != n_entries; ++i)
+ *     table.writable_data()[i] = expensive_fill(i);
+ * table.synchronize();
+ * // all processors: read table.data()[i]
+ * \endcode
+ *
+ * Without MPI (or with an MPI lacking shared windows) every processor
+ * is its own "node": each allocates privately and is its own writer,
+ * so the usage pattern above still works unchanged.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief One read-only copy of an array per shared-memory node.
+ */
+template <typename T>
+class SharedMemoryArray
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SharedMemoryArray entries are shared as raw bytes");
+
+public:
+  /**
+   * Allocates space for \p n_entries entries of type \p T, shared
+   * among all processors of \p comm living on the same node.  This is
+   * a collective operation.  The contents are uninitialized until the
+   * writer fills them and all processors \p synchronize().
+   */
+  SharedMemoryArray (const Communicator & comm,
+                     std::size_t n_entries);
+
+  /**
+   * Frees the shared segment.  Collective; all processors on a node
+   * must destroy their attachments together.
+   */
+  ~SharedMemoryArray ();
+
+  /**
+   * These objects own MPI resources, so they cannot be copied.
+   */
+  SharedMemoryArray (const SharedMemoryArray &) = delete;
+  SharedMemoryArray & operator= (const SharedMemoryArray &) = delete;
+
+  /**
+   * \returns \p true on the one processor per node responsible for
+   * filling the array.
+   */
+  bool is_writer () const { return _node_rank == 0; }
+
+  /**
+   * \returns A writable pointer to the segment.  Only the writer may
+   * store through it, and only before \p synchronize().
+   */
+  T * writable_data ()
+  {
+    libmesh_assert(this->is_writer());
+    return _base;
+  }
+
+  /**
+   * \returns A read-only pointer to the node's copy of the array.
+   * Valid on every processor after \p synchronize().
+   */
+  const T * data () const { return _base; }
+
+  /**
+   * \returns The number of entries in the array.
+   */
+  std::size_t size () const { return _n_entries; }
+
+  /**
+   * \returns The rank of this processor among the processors of its
+   * node; the writer is node rank 0.
+   */
+  processor_id_type node_rank () const { return _node_rank; }
+
+  /**
+   * \returns The number of processors sharing this node's copy.
+   */
+  processor_id_type node_size () const { return _node_size; }
+
+  /**
+   * Makes the writer's stores visible to the other processors on the
+   * node.  Collective over the original communicator; no processor may
+   * read \p data() it did not write until this returns everywhere.
+   */
+  void synchronize ();
+
+private:
+  T * _base;
+  std::size_t _n_entries;
+  processor_id_type _node_rank;
+  processor_id_type _node_size;
+
+#ifdef LIBMESH_HAVE_MPI
+  MPI_Comm _node_comm;
+  MPI_Win _win;
+  bool _have_window;
+#endif
+
+  // Private fallback storage, used without MPI shared windows
+  std::vector<T> _private_storage;
+};
+
+
+
+//--------------------------------------------------------------------------
+// SharedMemoryArray implementation
+template <typename T>
+inline
+SharedMemoryArray<T>::SharedMemoryArray (const Communicator & comm,
+                                         std::size_t n_entries) :
+  _base(nullptr),
+  _n_entries(n_entries),
+  _node_rank(0),
+  _node_size(1)
+#ifdef LIBMESH_HAVE_MPI
+  , _node_comm(MPI_COMM_NULL),
+  _win(MPI_WIN_NULL),
+  _have_window(false)
+#endif
+{
+#if defined(LIBMESH_HAVE_MPI) && (MPI_VERSION > 2)
+  libmesh_call_mpi
+    (MPI_Comm_split_type (comm.get(), MPI_COMM_TYPE_SHARED,
+                          comm.rank(), MPI_INFO_NULL, &_node_comm));
+
+  int node_rank, node_size;
+  libmesh_call_mpi (MPI_Comm_rank (_node_comm, &node_rank));
+  libmesh_call_mpi (MPI_Comm_size (_node_comm, &node_size));
+  _node_rank = cast_int<processor_id_type>(node_rank);
+  _node_size = cast_int<processor_id_type>(node_size);
+
+  // The writer provides the whole segment; everyone else asks for a
+  // zero-byte allocation and attaches to the writer's pages.
+  const MPI_Aint my_bytes = this->is_writer() ?
+    cast_int<MPI_Aint>(n_entries * sizeof(T)) : 0;
+
+  void * my_base = nullptr;
+  libmesh_call_mpi
+    (MPI_Win_allocate_shared (my_bytes, sizeof(T), MPI_INFO_NULL,
+                              _node_comm, &my_base, &_win));
+  _have_window = true;
+
+  MPI_Aint query_bytes;
+  int disp_unit;
+  void * node_base = nullptr;
+  libmesh_call_mpi
+    (MPI_Win_shared_query (_win, 0, &query_bytes, &disp_unit,
+                           &node_base));
+
+  _base = static_cast<T *>(node_base);
+#else
+  // Without MPI-3 shared windows each processor is its own node and
+  // holds a private copy, as a plain ReplicatedMesh-style user would.
+  libmesh_ignore(comm);
+  _private_storage.resize(n_entries);
+  _base = _private_storage.data();
+#endif
+}
+
+
+
+template <typename T>
+inline
+SharedMemoryArray<T>::~SharedMemoryArray ()
+{
+#ifdef LIBMESH_HAVE_MPI
+  if (_have_window)
+    libmesh_call_mpi (MPI_Win_free (&_win));
+  if (_node_comm != MPI_COMM_NULL)
+    libmesh_call_mpi (MPI_Comm_free (&_node_comm));
+#endif
+}
+
+
+
+template <typename T>
+inline
+void SharedMemoryArray<T>::synchronize ()
+{
+#if defined(LIBMESH_HAVE_MPI) && (MPI_VERSION > 2)
+  if (_have_window)
+    {
+      // In the unified memory model a sync plus a barrier makes the
+      // writer's stores visible to the readers on the node.
+      libmesh_call_mpi (MPI_Win_lock_all (MPI_MODE_NOCHECK, _win));
+      libmesh_call_mpi (MPI_Win_sync (_win));
+      libmesh_call_mpi (MPI_Barrier (_node_comm));
+      libmesh_call_mpi (MPI_Win_sync (_win));
+      libmesh_call_mpi (MPI_Win_unlock_all (_win));
+    }
+#endif
+}
+
+}
+
+}
+
+#endif // LIBMESH_SHARED_MEMORY_ARRAY_H
@@ -0,0 +1,159 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_TASK_EXECUTOR_H
+#define LIBMESH_TASK_EXECUTOR_H
+
+// Local includes
+#include "libmesh/libmesh_config.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+# include <condition_variable>
+# include <deque>
+# include <mutex>
+# include <thread>
+# include <vector>
+#endif
+
+namespace libMesh
+{
+
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
+namespace Threads
+{
+
+/**
+ * A simple thread-pool task executor, for coarse-grained task
+ * parallelism: running independent Systems' assemblies concurrently,
+ * overlapping I/O or QoI evaluation with computation, etc.  Tasks are
+ * submitted as callables and their results retrieved through
+ * \p std::future, so task parallelism composes with the fine-grained
+ * loop parallelism of \p parallel_for(): while \p n concurrently
+ * running tasks are live, each threaded loop restricts itself to
+ * roughly 1/n of the configured thread count (see \p
+ * num_active_tasks()), avoiding oversubscription.
+ *
+ * Without a working \p std::thread (no \p LIBMESH_HAVE_CXX11_THREAD)
+ * tasks simply execute immediately on the submitting thread, and the
+ * returned futures are ready upon return from \p submit().
+ *
+ * \author Roy Stogner
+ * \date 2020
+ * \brief Thread-pool executor composing task and loop parallelism.
+ */
+class TaskExecutor
+{
+public:
+  /**
+   * Constructor.  Starts a pool of \p n_workers worker threads, or of
+   * \p libMesh::n_threads() workers if \p n_workers is zero.
+   */
+  explicit TaskExecutor (unsigned int n_workers = 0);
+
+  /**
+   * Destructor.  Waits for all submitted tasks to finish, then joins
+   * the workers.
+   */
+  ~TaskExecutor ();
+
+  /**
+   * This class manages worker threads and so cannot be copied.
+   */
+  TaskExecutor (const TaskExecutor &) = delete;
+  TaskExecutor & operator= (const TaskExecutor &) = delete;
+
+  /**
+   * Submits the callable \p f for asynchronous execution on the pool.
+   *
+   * \returns A future holding \p f's eventual result; any exception
+   * \p f throws is captured and rethrown from \p future::get().
+   */
+  template <typename Callable>
+  std::future<typename std::result_of<Callable()>::type>
+  submit (Callable f)
+  {
+    typedef typename std::result_of<Callable()>::type result_type;
+
+    auto task =
+      std::make_shared<std::packaged_task<result_type()>>(std::move(f));
+
+    std::future<result_type> result = task->get_future();
+
+    this->run_task([task](){ (*task)(); });
+
+    return result;
+  }
+
+  /**
+   * \returns The number of worker threads in the pool.
+   */
+  unsigned int n_workers () const { return _n_workers; }
+
+  /**
+   * \returns The executor shared by all users of \p comm, building it
+   * on first use.  The pool of the shared executor holds \p n_workers
+   * threads, or \p libMesh::n_threads() if \p n_workers is zero;
+   * \p n_workers is ignored on calls after the first, which merely
+   * look the executor up.  Executors are keyed by communicator object
+   * identity, so pass a long-lived communicator such as the one a
+   * \p ParallelObject holds, not a temporary copy.
+   */
+  static TaskExecutor & get_executor (const Parallel::Communicator & comm,
+                                      unsigned int n_workers = 0);
+
+private:
+
+  /**
+   * Queues \p task for the workers, or runs it immediately on the
+   * calling thread when no threading model is available.
+   */
+  void run_task (std::function<void()> task);
+
+  /**
+   * What each worker thread runs: pop and execute tasks until told to
+   * finish, maintaining the active-task count around each execution.
+   */
+  void worker_loop ();
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+  std::vector<std::thread> _workers;
+  std::deque<std::function<void()>> _queue;
+  std::mutex _queue_mtx;
+  std::condition_variable _queue_cv;
+  bool _done;
+#endif
+
+  unsigned int _n_workers;
+};
+
+} // namespace Threads
+
+} // namespace libMesh
+
+#endif // LIBMESH_TASK_EXECUTOR_H
@@ -23,6 +23,9 @@
 #include "libmesh/libmesh_config.h"
 #include "libmesh/libmesh_common.h"  // for libmesh_assert
 
+// C++ includes
+#include <atomic>
+
 
 // Compile-time check: TBB and pthreads are now mutually exclusive.
 #if defined(LIBMESH_HAVE_TBB_API) && defined(LIBMESH_HAVE_PTHREAD)
@@ -40,25 +43,76 @@ namespace Threads
 {
 
 /**
- * A boolean which is true iff we are in a Threads:: function
- * It may be useful to assert(!Threads::in_threads) in any code
- * which is known to not be thread-safe.
+ * A count of the threaded execution regions currently running, which
+ * is nonzero (and so converts to boolean true) iff we are in a
+ * Threads:: function.  It may be useful to
+ * assert(!Threads::in_threads) in any code which is known to not be
+ * thread-safe.  This used to be a plain bool, but with a TaskExecutor
+ * two independent threaded loops may legitimately be live at once, so
+ * we count regions instead of flagging the first one.
+ */
+extern std::atomic<int> in_threads;
+
+/**
+ * \returns The number of TaskExecutor tasks currently executing.
+ * Threaded loops divide the configured thread count among the running
+ * tasks (see \p num_pthreads()), so that fine-grained loop parallelism
+ * inside concurrently running coarse tasks does not oversubscribe the
+ * machine.
+ */
+unsigned int num_active_tasks ();
+
+/**
+ * When true, and when the pthreads-based threading implementation is
+ * in use, parallel_for() and parallel_reduce() deal fine-grained
+ * chunks of their range into one deque per worker and let idle
+ * workers steal chunks from busy ones, instead of handing each worker
+ * a fixed contiguous block.  This load-balances loops whose per-item
+ * cost varies widely, such as assembly over mixed element types, at
+ * the price of a little scheduling overhead.  With TBB the underlying
+ * scheduler already steals work and this flag is ignored.  It may be
+ * set directly at runtime (outside of any threaded region), and is
+ * also set by the \p --dynamic-thread-scheduling command line option.
+ */
+extern bool dynamic_scheduling;
+
+/**
+ * When true, and when the pthreads-based threading implementation is
+ * in use, the worker which handles the i'th block of a statically
+ * partitioned parallel_for() or parallel_reduce() range is pinned to
+ * logical core i.  Combined with the fixed block partition this means
+ * the same core touches the same slice of data on every loop, which
+ * is what makes first-touch page placement effective on NUMA nodes:
+ * pages end up on the socket of the core that will keep using them
+ * instead of all on socket 0.  Also enables threaded first-touch
+ * zeroing of freshly allocated PetscVector storage.  It may be set
+ * directly at runtime (outside of any threaded region), and is also
+ * set by the \p --pin-threads command line option.
+ */
+extern bool pin_threads;
+
+/**
+ * Binds the calling thread to logical core \p core (taken modulo the
+ * number of online cores) where the platform supports it; currently a
+ * no-op everywhere but Linux with pthreads available.
  */
-extern bool in_threads;
+void bind_this_thread_to_core (unsigned int core);
 
 /**
- * We use a class to turn Threads::in_threads on and off, to be
+ * We use a class to track Threads::in_threads regions, to be
  * exception-safe.
  */
 class BoolAcquire
 {
 public:
   explicit
-  BoolAcquire(bool & b) : _b(b) { libmesh_assert(!_b); _b = true; }
+  BoolAcquire(std::atomic<int> & b) : _b(b)
+  { libmesh_assert_greater_equal(_b.load(), 0); ++_b; }
 
-  ~BoolAcquire() { libmesh_exceptionless_assert(_b); _b = false; }
+  ~BoolAcquire()
+  { libmesh_exceptionless_assert(_b.load() > 0); --_b; }
 private:
-  bool & _b;
+  std::atomic<int> & _b;
 };
 
 
@@ -213,7 +213,13 @@ private:
 template <typename Range>
 unsigned int num_pthreads(Range & range)
 {
-  std::size_t min = std::min((std::size_t)libMesh::n_threads(), range.size());
+  // Divide the configured thread count among any TaskExecutor tasks
+  // currently running, so that a threaded loop inside a task does not
+  // oversubscribe cores shared with other concurrently running tasks.
+  const unsigned int our_share =
+    std::max(1u, libMesh::n_threads() / std::max(1u, num_active_tasks()));
+
+  std::size_t min = std::min((std::size_t)our_share, range.size());
   return min > 0 ? cast_int<unsigned int>(min) : 1;
 }
 
@@ -223,6 +229,12 @@ class RangeBody
 public:
   Range * range;
   Body * body;
+
+  /**
+   * Logical core to pin the worker running this block to, or -1 to
+   * leave its affinity alone.
+   */
+  int pin_to_core = -1;
 };
 
 template <typename Range, typename Body>
@@ -230,6 +242,10 @@ void * run_body(void * args)
 {
   RangeBody<Range, Body> * range_body = (RangeBody<Range, Body> *)args;
 
+  if (range_body->pin_to_core >= 0)
+    bind_this_thread_to_core
+      (static_cast<unsigned int>(range_body->pin_to_core));
+
   Body & body = *range_body->body;
   Range & range = *range_body->range;
 
@@ -238,6 +254,151 @@ void * run_body(void * args)
   return nullptr;
 }
 
+/**
+ * A per-worker chunk deque for the work-stealing scheduler.  The
+ * owning worker takes chunks from the back; idle workers steal from
+ * the front, so a victim keeps the chunks adjacent to the ones it has
+ * been executing.  A spin mutex keeps the two ends consistent; it is
+ * only ever contended while stealing, which is rare.
+ */
+template <typename Range>
+class StealableDeque
+{
+public:
+  StealableDeque () : head(0), tail(0) {}
+
+  /**
+   * Adds a chunk.  Only used while dealing out chunks before the
+   * workers start, so no locking is needed.
+   */
+  void push (Range * chunk)
+  {
+    chunks.push_back(chunk);
+    tail = chunks.size();
+  }
+
+  /**
+   * \returns The next of this worker's own chunks, or \p nullptr if
+   * none remain.
+   */
+  Range * take ()
+  {
+    spin_mutex::scoped_lock lock(mtx);
+    if (head == tail)
+      return nullptr;
+    return chunks[--tail];
+  }
+
+  /**
+   * \returns A chunk stolen from the far end of this deque, or \p
+   * nullptr if none remain.
+   */
+  Range * steal ()
+  {
+    spin_mutex::scoped_lock lock(mtx);
+    if (head == tail)
+      return nullptr;
+    return chunks[head++];
+  }
+
+private:
+  spin_mutex mtx;
+  std::vector<Range *> chunks;
+  std::size_t head, tail;
+};
+
+
+template <typename Range, typename Body>
+class StealingWorker
+{
+public:
+  std::vector<StealableDeque<Range>> * deques;
+  Body * body;
+  unsigned int id;
+};
+
+
+template <typename Range, typename Body>
+void * run_stealing_body (void * args)
+{
+  StealingWorker<Range, Body> * worker = (StealingWorker<Range, Body> *)args;
+
+  if (pin_threads)
+    bind_this_thread_to_core(worker->id);
+
+  Body & body = *worker->body;
+  std::vector<StealableDeque<Range>> & deques = *worker->deques;
+  const unsigned int n = cast_int<unsigned int>(deques.size());
+
+  // No chunk ever creates more chunks, so once every deque comes up
+  // empty in a full scan we are done.
+  while (true)
+    {
+      // Our own work first...
+      Range * chunk = deques[worker->id].take();
+
+      // ...then anyone else's
+      for (unsigned int k=1; chunk == nullptr && k<n; ++k)
+        chunk = deques[(worker->id + k) % n].steal();
+
+      if (chunk == nullptr)
+        break;
+
+      body(*chunk);
+    }
+
+  return nullptr;
+}
+
+
+/**
+ * Splits \p range into fine-grained chunks and deals them out
+ * contiguously over \p deques, so each worker starts on the same
+ * block of the range a static split would have given it, and thieves
+ * take from the far end of a victim's block.  The caller is
+ * responsible for deleting the \p chunks afterwards.
+ */
+template <typename Range>
+void fill_stealing_deques (const Range & range,
+                           std::vector<StealableDeque<Range>> & deques,
+                           std::vector<Range *> & chunks)
+{
+  const unsigned int n_workers = cast_int<unsigned int>(deques.size());
+
+  // Aim for several chunks per worker, so that the cost imbalance
+  // within any one chunk stays small, but keep chunks at least as
+  // large as the range's grainsize, which is there to amortize
+  // per-chunk overhead.
+  const std::size_t chunk_size =
+    std::max(range.grainsize(),
+             std::max(std::size_t(1),
+                      range.size() / (8 * n_workers)));
+
+  typename Range::const_iterator chunk_begin = range.begin();
+  std::size_t remaining = range.size();
+
+  while (remaining)
+    {
+      const std::size_t this_chunk_size = std::min(chunk_size, remaining);
+      chunks.push_back(new Range(range, chunk_begin, chunk_begin + this_chunk_size));
+      chunk_begin = chunk_begin + this_chunk_size;
+      remaining -= this_chunk_size;
+    }
+
+  const std::size_t chunks_per_worker = chunks.size() / n_workers;
+  const std::size_t leftover_chunks = chunks.size() % n_workers;
+
+  std::size_t c = 0;
+  for (unsigned int i=0; i<n_workers; i++)
+    {
+      const std::size_t n_chunks_i = chunks_per_worker + (i < leftover_chunks);
+
+      for (std::size_t j=0; j<n_chunks_i; j++)
+        deques[i].push(chunks[c++]);
+    }
+}
+
+
 /**
  * Scheduler to manage threads.
  */
@@ -286,6 +447,45 @@ void parallel_for (const Range & range, const Body & body)
 #endif
   unsigned int n_threads = num_pthreads(range);
 
+  // Work-stealing path: rather than one fixed block per worker, deal
+  // fine-grained chunks into per-worker deques and let idle workers
+  // steal, so loops with widely varying per-item cost load-balance.
+  if (dynamic_scheduling && n_threads > 1)
+    {
+      std::vector<StealableDeque<const Range>> deques(n_threads);
+      std::vector<const Range *> chunks;
+      fill_stealing_deques(range, deques, chunks);
+
+      std::vector<StealingWorker<const Range, const Body>> workers(n_threads);
+      std::vector<pthread_t> stealing_threads(n_threads);
+
+      for (unsigned int i=0; i<n_threads; i++)
+        {
+          workers[i].deques = &deques;
+          workers[i].body = &body;
+          workers[i].id = i;
+
+          pthread_create(&stealing_threads[i], nullptr,
+                         &run_stealing_body<const Range, const Body>,
+                         (void *)&workers[i]);
+        }
+
+      // Wait for them to finish
+      for (unsigned int i=0; i<n_threads; i++)
+        pthread_join(stealing_threads[i], nullptr);
+
+      // Clean up
+      for (std::size_t i=0; i<chunks.size(); i++)
+        delete chunks[i];
+
+#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+      if (libMesh::n_threads() > 1 && logging_was_enabled)
+        libMesh::perflog.enable_logging();
+#endif
+
+      return;
+    }
+
   std::vector<Range *> ranges(n_threads);
   std::vector<RangeBody<const Range, const Body>> range_bodies(n_threads);
   std::vector<pthread_t> threads(n_threads);
@@ -312,6 +512,11 @@ void parallel_for (const Range & range, const Body & body)
     {
       range_bodies[i].range = ranges[i];
       range_bodies[i].body = &body;
+
+      // Pin block i to core i upon request, so first-touch page
+      // placement matches later loops over the same partition.
+      if (pin_threads)
+        range_bodies[i].pin_to_core = cast_int<int>(i);
     }
 
   // Create the threads.  It may seem redundant to wrap a pragma in
@@ -390,15 +595,62 @@ void parallel_reduce (const Range & range, Body & body)
 
   unsigned int n_threads = num_pthreads(range);
 
-  std::vector<Range *> ranges(n_threads);
   std::vector<Body *> bodies(n_threads);
-  std::vector<RangeBody<Range, Body>> range_bodies(n_threads);
 
   // Create copies of the body for each thread
   bodies[0] = &body; // Use the original body for the first one
   for (unsigned int i=1; i<n_threads; i++)
     bodies[i] = new Body(body, Threads::split());
 
+  // Work-stealing path: rather than one fixed block per worker, deal
+  // fine-grained chunks into per-worker deques and let idle workers
+  // steal.  Each worker still accumulates into its own Body copy, so
+  // the usual join() chain below applies unchanged.
+  if (dynamic_scheduling && n_threads > 1)
+    {
+      std::vector<StealableDeque<Range>> deques(n_threads);
+      std::vector<Range *> chunks;
+      fill_stealing_deques(range, deques, chunks);
+
+      std::vector<StealingWorker<Range, Body>> workers(n_threads);
+      std::vector<pthread_t> stealing_threads(n_threads);
+
+      for (unsigned int i=0; i<n_threads; i++)
+        {
+          workers[i].deques = &deques;
+          workers[i].body = bodies[i];
+          workers[i].id = i;
+
+          pthread_create(&stealing_threads[i], nullptr,
+                         &run_stealing_body<Range, Body>,
+                         (void *)&workers[i]);
+        }
+
+      // Wait for them to finish
+      for (unsigned int i=0; i<n_threads; i++)
+        pthread_join(stealing_threads[i], nullptr);
+
+      // Join them all down to the original Body
+      for (unsigned int i=n_threads-1; i != 0; i--)
+        bodies[i-1]->join(*bodies[i]);
+
+      // Clean up
+      for (unsigned int i=1; i<n_threads; i++)
+        delete bodies[i];
+      for (std::size_t i=0; i<chunks.size(); i++)
+        delete chunks[i];
+
+#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+      if (libMesh::n_threads() > 1 && logging_was_enabled)
+        libMesh::perflog.enable_logging();
+#endif
+
+      return;
+    }
+
+  std::vector<Range *> ranges(n_threads);
+  std::vector<RangeBody<Range, Body>> range_bodies(n_threads);
+
   // Create the ranges for each thread
   std::size_t range_size = range.size() / n_threads;
 
@@ -421,6 +673,10 @@ void parallel_reduce (const Range & range, Body & body)
     {
       range_bodies[i].range = ranges[i];
       range_bodies[i].body = bodies[i];
+
+      // Pin block i to core i upon request, as in parallel_for().
+      if (pin_threads)
+        range_bodies[i].pin_to_core = cast_int<int>(i);
     }
 
   // Create the threads
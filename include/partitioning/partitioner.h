@@ -54,7 +54,7 @@ public:
   /**
    * Constructor.
    */
-  Partitioner () : _weights(nullptr) {}
+  Partitioner () : _weights(nullptr), _refine_existing_partition(false) {}
 
   /**
    * Copy/move ctor, copy/move assignment operator, and destructor are
@@ -202,6 +202,24 @@ public:
    */
   virtual void attach_weights(ErrorVector * /*weights*/) { libmesh_not_implemented(); }
 
+  /**
+   * Setting this to true makes partition() on an already-partitioned
+   * mesh refine the existing partitioning -- a k-way greedy diffusion
+   * which moves partition-boundary elements away from overloaded
+   * processors -- instead of computing a new partitioning from
+   * scratch.  Most elements keep their current processor id, so
+   * redistribution after e.g. an AMR step moves far less data.  The
+   * existing partitioning can only be refined this way on serialized
+   * meshes; otherwise (and whenever no acceptable refinement of the
+   * current partitioning exists) we fall back on the full
+   * _do_partition().  Default false.
+   */
+  void set_refine_existing_partition(bool val)
+  { _refine_existing_partition = val; }
+
+  bool refine_existing_partition() const
+  { return _refine_existing_partition; }
+
 protected:
 
   /**
@@ -227,6 +245,18 @@ protected:
   virtual void _do_partition(MeshBase & mesh,
                              const unsigned int n) = 0;
 
+  /**
+   * Attempts to refine the mesh's existing partitioning into \p n
+   * parts by diffusing overloaded processors' partition-boundary
+   * elements onto underloaded neighboring processors, leaving all
+   * other elements on their current processors.
+   *
+   * \returns \p true if the existing partitioning was successfully
+   * rebalanced, \p false if a full partitioning is required instead.
+   */
+  bool _refine_current_partition (MeshBase & mesh,
+                                  const unsigned int n);
+
   /**
    * This is the actual re-partitioning method which can be overridden
    * in derived classes.
@@ -266,6 +296,13 @@ protected:
    */
   ErrorVector * _weights;
 
+  /**
+   * \p true if partition() should try to refine the mesh's existing
+   * partitioning rather than compute a new one from scratch.  See
+   * set_refine_existing_partition().
+   */
+  bool _refine_existing_partition;
+
   /**
    * Maps active element ids into a contiguous range, as needed by parallel partitioner.
    */
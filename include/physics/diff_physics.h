@@ -511,6 +511,31 @@ public:
   { return _second_order_vars.find(var) != _second_order_vars.end(); }
 
 
+  /**
+   * Tells the DifferentiablePhysics that its element kernels read the
+   * solution values of variable \p var.  By default a physics is
+   * assumed to read every system variable, and
+   * FEMContext::pre_fe_reinit() gathers them all; once any variable
+   * has been declared here, contexts built by FEMSystem only gather
+   * the declared variables (plus any time evolving variables, whose
+   * values time solvers read).  In general, the user's init()
+   * function should declare the variables its kernels use, alongside
+   * any time_evolving() calls.
+   */
+  virtual void reads_variable (unsigned int var);
+
+  bool have_requested_vars() const
+  { return !_requested_vars.empty(); }
+
+  /**
+   * \returns The set of variable indices whose solution values this
+   * physics has declared that it reads.  May be empty, in which case
+   * every variable is assumed to be read.
+   */
+  const std::set<unsigned int> & get_requested_vars() const
+  { return _requested_vars; }
+
+
 protected:
 
   /**
@@ -540,6 +565,12 @@ protected:
    */
   std::set<unsigned int> _second_order_vars;
 
+  /**
+   * Variable indices whose solution values our kernels read; empty
+   * means all of them.
+   */
+  std::set<unsigned int> _requested_vars;
+
   /**
    * If the user adds any second order variables, then we need to also
    * cache the map to their corresponding dot variable that will
@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/point.h"
+#include "libmesh/id_types.h"
 #include "libmesh/enum_elem_type.h" // INVALID_ELEM
 #include "libmesh/enum_order.h" // INVALID_ORDER
 
@@ -37,6 +38,7 @@ enum QuadratureType : int;
 #endif
 
 // C++ includes
+#include <map>
 #include <vector>
 #include <string>
 #include <utility>
@@ -196,6 +198,38 @@ public:
                      const std::vector<Real> & vertex_distance_func,
                      unsigned int p_level=0);
 
+  /**
+   * Convenience initialization for an uncut element.  Applies any
+   * per-subdomain order selection made via \p set_subdomain_order()
+   * before dispatching to the generic implementation.
+   *
+   * \returns \p true if the order of the rule changed for this
+   * element, in which case shape functions evaluated at the old
+   * quadrature points must be recomputed.
+   */
+  bool init (const Elem & elem,
+             unsigned int p_level=0);
+
+  /**
+   * Requests that elements in subdomain \p sid be integrated with a
+   * rule of order \p order in place of the order this rule was built
+   * with.  This lets assemblies avoid over-integrating subdomains
+   * where the integrand is known to be smooth or low-order while
+   * keeping the conservative default elsewhere.  The selection takes
+   * effect in the element-aware init() overloads, as used by
+   * FE::reinit() for volume integration; retabulations triggered by
+   * switching between subdomains are served out of the process-wide
+   * tabulation cache.
+   */
+  void set_subdomain_order (subdomain_id_type sid, Order order);
+
+  /**
+   * Removes all per-subdomain order selections made via
+   * set_subdomain_order(); subsequent initializations revert to the
+   * order the rule was built with.
+   */
+  void clear_subdomain_orders ();
+
   /**
    * \returns The current "total" order of the quadrature rule which
    * can vary element by element, depending on the Elem::p_level(),
@@ -238,6 +272,16 @@ public:
    */
   virtual bool shapes_need_reinit() { return false; }
 
+  /**
+   * \returns \p true if this rule's points and weights are determined
+   * entirely by its type(), dimension, order, element type, p-level,
+   * and the negative-weights flag, so that its tabulation may be
+   * shared through a process-wide cache in \p QBase::init().  Rules
+   * carrying additional runtime state must override this to return
+   * \p false.
+   */
+  virtual bool is_tabulation_cachable () const { return true; }
+
   /**
    * Flag (default true) controlling the use of quadrature rules with
    * negative weights.  Set this to false to require rules with all
@@ -356,6 +400,19 @@ protected:
    */
   unsigned int _p_level;
 
+  /**
+   * The order this rule was built with.  \p _order normally equals
+   * this, but the element-aware init() may replace it on subdomains
+   * given a different order via set_subdomain_order().
+   */
+  Order _default_order;
+
+  /**
+   * Per-subdomain quadrature order selections, applied by the
+   * element-aware init().
+   */
+  std::map<subdomain_id_type, Order> _subdomain_orders;
+
   /**
    * The locations of the quadrature points in reference element
    * space.
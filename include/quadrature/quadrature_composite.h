@@ -30,7 +30,9 @@
 #include "libmesh/fe_base.h"
 
 // C++ includes
+#include <map>
 #include <memory>
+#include <tuple>
 
 namespace libMesh
 {
@@ -94,6 +96,50 @@ public:
                      const std::vector<Real> & vertex_distance_func,
                      unsigned int p_level=0) override;
 
+  /**
+   * Initializes composite rules for a whole batch of elements at
+   * once, writing each element's tabulation to \p batch_points and \p
+   * batch_weights.  Uncut elements are served from the ordinary
+   * subcell tabulations; cut elements are grouped by cut signature so
+   * each distinct cut geometry is re-triangulated only once, and the
+   * cutting work is threaded over those distinct geometries.
+   */
+  void init_batch (const std::vector<const Elem *> & elems,
+                   const std::vector<std::vector<Real>> & vertex_distance_funcs,
+                   std::vector<std::vector<Point>> & batch_points,
+                   std::vector<std::vector<Real>> & batch_weights,
+                   unsigned int p_level=0);
+
+  /**
+   * Sets the tolerance for reusing cut tabulations.  With a positive
+   * tolerance, init() and init_batch() cache each cut element's
+   * points and weights keyed by element type and by its vertex
+   * distances normalized to unit magnitude and snapped to a grid of
+   * the given spacing, so elements whose level-set sign patterns
+   * agree to within the tolerance share one re-triangulation.  A zero
+   * tolerance (the default) disables the cache; init_batch() then
+   * still combines exactly matching cuts within one sweep.
+   */
+  void set_reuse_tolerance (Real tol) { _reuse_tolerance = tol; }
+
+  /**
+   * \returns The tolerance for reusing cut tabulations.
+   */
+  Real reuse_tolerance () const { return _reuse_tolerance; }
+
+  /**
+   * Drops all cached cut tabulations, e.g. after the level set
+   * changes more than the reuse tolerance should paper over.
+   */
+  void clear_reuse_cache () { _cut_cache.clear(); }
+
+  /**
+   * Composite tabulations depend on the cut geometry of individual
+   * elements and on the subcell rule type, neither of which is part
+   * of the tabulation cache key.
+   */
+  virtual bool is_tabulation_cachable () const override { return false; }
+
 private:
 
   /**
@@ -102,6 +148,20 @@ private:
    */
   void add_subelem_values (const std::vector<Elem const *> & subelem);
 
+  /**
+   * Cache key identifying a cut geometry: element type, p level, and
+   * the normalized (and, with a positive reuse tolerance, quantized)
+   * vertex distance function.
+   */
+  typedef std::tuple<ElemType, unsigned int, std::vector<Real>> CutSignature;
+
+  /**
+   * Builds the cache key for a cut element.
+   */
+  CutSignature cut_signature (const Elem & elem,
+                              const std::vector<Real> & vertex_distance_func,
+                              unsigned int p_level) const;
+
   /**
    * Subcell quadrature object.
    */
@@ -116,6 +176,16 @@ private:
    * Lagrange FE to use for subcell mapping.
    */
   std::unique_ptr<FEBase> _lagrange_fe;
+
+  /**
+   * Tolerance for reusing cut tabulations; 0 disables the cache.
+   */
+  Real _reuse_tolerance;
+
+  /**
+   * Cached points and weights of previously cut geometries.
+   */
+  std::map<CutSignature, std::pair<std::vector<Point>, std::vector<Real>>> _cut_cache;
 };
 
 } // namespace libMesh
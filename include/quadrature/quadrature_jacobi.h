@@ -81,6 +81,13 @@ public:
    */
   virtual QuadratureType type() const override;
 
+  /**
+   * Only the (alpha, beta) pairs with a QuadratureType of their own
+   * can be distinguished by the tabulation cache key.
+   */
+  virtual bool is_tabulation_cachable () const override
+  { return (_alpha == 1 || _alpha == 2) && _beta == 0; }
+
 private:
   unsigned int _alpha;
   unsigned int _beta;
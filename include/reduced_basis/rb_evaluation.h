@@ -202,6 +202,20 @@ public:
                                          const std::string & directory_name = "offline_data",
                                          const bool write_binary_basis_functions = true);
 
+  /**
+   * Write each basis function to its own file ("bf0", "bf1", ...)
+   * instead of the single blocked file produced by
+   * write_out_basis_functions().  The single-file format interleaves
+   * all basis functions block-by-block, so it can only be read back
+   * in its entirety; per-function files allow an Online stage to
+   * stream one basis function at a time, e.g. via
+   * read_in_basis_function_combination(), and hence reconstruct
+   * truth-space fields with only one truth vector in memory.
+   */
+  virtual void write_out_separate_basis_functions(System & sys,
+                                                  const std::string & directory_name = "offline_data",
+                                                  const bool write_binary_basis_functions = true);
+
   /**
    * Same as write_out_basis_functions, except in this case we pass in the vectors to be
    * written.
@@ -223,6 +237,24 @@ public:
                                        const std::string & directory_name = "offline_data",
                                        const bool read_binary_basis_functions = true);
 
+  /**
+   * Set \p combination to the linear combination of the basis
+   * functions with the given \p coefficients, streaming the basis
+   * functions one at a time from the per-function files written by
+   * write_out_separate_basis_functions().  This allows an Online
+   * stage to reconstruct a truth-space field (cf.
+   * RBConstruction::load_rb_solution()) without ever storing the
+   * full set of basis functions: only a single temporary truth
+   * vector is allocated, regardless of the number of basis
+   * functions.  \p combination must already be initialized to the
+   * truth-space layout.
+   */
+  void read_in_basis_function_combination(System & sys,
+                                          NumericVector<Number> & combination,
+                                          const DenseVector<Number> & coefficients,
+                                          const std::string & directory_name = "offline_data",
+                                          const bool read_binary_basis_functions = true);
+
   /**
    * Same as read_in_basis_functions, except in this case we pass in the vectors to be
    * written. We assume that the size of vectors indicates the number of vectors
@@ -96,6 +96,23 @@ public:
                                        subdomain_id_type subdomain_id,
                                        const std::vector<Point> & xyz_perturb) = 0;
 
+  /**
+   * Evaluate the parametrized function at all of the points in \p
+   * all_xyz for a single parameter \p mu, filling \p output so that
+   * output[point_index][comp] gives the comp'th component at that
+   * point.  The base class implementation simply calls evaluate()
+   * once per point; subclasses whose evaluation has per-call overhead
+   * (table lookups, external library calls, etc.) should override
+   * this to process the entire batch of points in one shot.  If
+   * requires_xyz_perturbations==false, then all_xyz_perturb will not
+   * be used.
+   */
+  virtual void evaluate_batch(const RBParameters & mu,
+                              const std::vector<Point> & all_xyz,
+                              const std::vector<subdomain_id_type> & sbd_ids,
+                              const std::vector<std::vector<Point>> & all_xyz_perturb,
+                              std::vector<std::vector<Number>> & output);
+
   /**
    * Vectorized version of evaluate. If requires_xyz_perturbations==false, then all_xyz_perturb will not be used.
    */
@@ -115,14 +132,38 @@ public:
                                                          const std::unordered_map<dof_id_type, subdomain_id_type> & sbd_ids,
                                                          const std::unordered_map<dof_id_type, std::vector<std::vector<Point>> > & all_xyz_perturb);
 
+  /**
+   * Same as the single-parameter preevaluate_parametrized_function_on_mesh(),
+   * but evaluates for every parameter in \p mus in one
+   * vectorized_evaluate() call.  This amortizes any batch setup cost
+   * across an entire training set, and since \p all_xyz typically
+   * holds only the quadrature points of the local mesh partition the
+   * evaluation work is distributed across processors.
+   */
+  virtual void preevaluate_parametrized_function_on_mesh(const std::vector<RBParameters> & mus,
+                                                         const std::unordered_map<dof_id_type, std::vector<Point>> & all_xyz,
+                                                         const std::unordered_map<dof_id_type, subdomain_id_type> & sbd_ids,
+                                                         const std::unordered_map<dof_id_type, std::vector<std::vector<Point>> > & all_xyz_perturb);
+
   /**
    * Look up the preevaluate values of the parametrized function for
    * component \p comp, element \p elem_id, and quadrature point \p qp.
+   * This requires that we preevaluated for exactly one parameter.
    */
   virtual Number lookup_preevaluated_value_on_mesh(unsigned int comp,
                                                    dof_id_type elem_id,
                                                    unsigned int qp) const;
 
+  /**
+   * Look up the preevaluated values of the parametrized function for
+   * parameter index \p mu_index, component \p comp, element \p
+   * elem_id, and quadrature point \p qp.
+   */
+  virtual Number lookup_preevaluated_value_on_mesh(unsigned int mu_index,
+                                                   unsigned int comp,
+                                                   dof_id_type elem_id,
+                                                   unsigned int qp) const;
+
   /**
    * If this parametrized function is defined based on a lookup table then
    * we can call this function to initialize the table. This is a no-op by
@@ -21,12 +21,19 @@
 #define DIRECTSOLUTIONTRANSFER_H
 
 #include "libmesh/solution_transfer.h"
+#include "libmesh/id_types.h"
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
 
+// Forward declarations
+class System;
+
 /**
  * Implementation of a SolutionTransfer object that only works for
  * transferring the solution but only in the case of:
@@ -47,8 +54,43 @@ public:
 
   /**
    * Transfer the values of a variable to another.
+   *
+   * The source-to-destination dof index mapping is built on the first
+   * transfer between a given pair of variables and cached, so
+   * repeated transfers (e.g. coupled systems exchanging data every
+   * timestep) only pay for a bulk gather/scatter of the values.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) override;
+
+  /**
+   * Drops all cached dof index mappings.  Call this if the dof
+   * distribution of any involved system may have changed, e.g. after
+   * mesh refinement or adding variables, since cached mappings would
+   * then be stale.
+   */
+  void clear_cache();
+
+private:
+
+  /**
+   * The source-to-destination dof index mapping for one pair of
+   * variables, along with the local dof counts it was built for so
+   * obviously-stale mappings can be rebuilt automatically.
+   */
+  struct DofMapping
+  {
+    std::vector<numeric_index_type> from_indices;
+    std::vector<numeric_index_type> to_indices;
+    dof_id_type from_n_local_dofs = static_cast<dof_id_type>(-1);
+    dof_id_type to_n_local_dofs = static_cast<dof_id_type>(-1);
+  };
+
+  /**
+   * Cached index mappings, keyed by the source and destination
+   * (system, variable number) pairs.
+   */
+  typedef std::pair<const System *, unsigned int> VariableKey;
+  std::map<std::pair<VariableKey, VariableKey>, DofMapping> _cached_mappings;
 };
 
 } // namespace libMesh
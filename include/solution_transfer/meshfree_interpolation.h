@@ -317,11 +317,6 @@ protected:
   const Real         _half_power;
   const unsigned int _n_interp_pts;
 
-  /**
-   * Temporary work array.  Object level scope to avoid cache thrashing.
-   */
-  mutable std::vector<Number> _vals;
-
 public:
 
   /**
@@ -27,6 +27,9 @@
 #include "libmesh/radial_basis_functions.h"
 #include "libmesh/bounding_box.h"
 
+// C++ includes
+#include <memory>
+
 
 
 namespace libMesh
@@ -71,6 +74,24 @@ protected:
    */
   Real _r_override;
 
+  /**
+   * If \p true (the default), \p prepare_for_use() reuses the cached
+   * factorization of the RBF coefficient matrix whenever the source
+   * points are unchanged since the last call, so repeated transfers
+   * with new source values only pay for a triangular solve.  Updated
+   * source values edited in place through \p get_source_vals() are
+   * assumed consistent across processors, as the SYNC_SOURCES gather
+   * leaves them.
+   */
+  bool _reuse_factorization;
+
+  /**
+   * Cached factorization of the RBF coefficient matrix; an opaque
+   * type so the solver details stay out of this header.
+   */
+  struct FactorizationCache;
+  std::unique_ptr<FactorizationCache> _cache;
+
 public:
 
   /**
@@ -80,12 +101,25 @@ public:
                             Real radius=-1) :
     InverseDistanceInterpolation<KDDim> (comm_in,8,2),
     _r_bbox(0.),
-    _r_override(radius)
+    _r_override(radius),
+    _reuse_factorization(true)
   { libmesh_experimental(); }
 
   /**
-   * Clears all internal data structures and restores to a
-   * pristine state.
+   * Destructor.
+   */
+  virtual ~RadialBasisInterpolation ();
+
+  /**
+   * Enables or disables factorization reuse across repeated
+   * \p prepare_for_use() calls; see \p _reuse_factorization.
+   */
+  void reuse_factorization (bool reuse)
+  { _reuse_factorization = reuse; }
+
+  /**
+   * Clears all internal data structures, including any cached
+   * factorization, and restores to a pristine state.
    */
   virtual void clear() override;
 
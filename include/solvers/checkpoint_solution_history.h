@@ -0,0 +1,171 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+#define LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+
+// Local includes
+#include "libmesh/memory_solution_history.h"
+#include "libmesh/solution_history.h"
+
+// C++ includes
+#include <functional>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Subclass of SolutionHistory which trades storage for recomputation.
+ * During the forward time march only a bounded number of snapshots is
+ * kept in memory; the interior snapshot set is thinned greedily so
+ * that the remaining checkpoints stay roughly evenly spaced in step
+ * index.  When the adjoint sweep asks for a time instant whose
+ * snapshot was thinned away, the nearest earlier checkpoint is
+ * restored into the System and the missing segment is recomputed by
+ * repeatedly invoking a user-supplied forward substep callback.
+ * Every recomputed step is snapshotted, so each forward step is
+ * recomputed at most once over the whole adjoint sweep - roughly one
+ * extra forward solve in total - at a transient memory high-water
+ * mark of the checkpoint budget plus one segment.
+ *
+ * This is a simplification of revolve-style binomial checkpointing:
+ * segments are replayed at a single level rather than recursively,
+ * which is the better trade whenever one segment's worth of states
+ * fits in memory.
+ *
+ * \author Vikram Garg
+ * \date 2020
+ * \brief Stores a bounded number of timesteps, recomputing the rest.
+ */
+class CheckpointSolutionHistory : public SolutionHistory
+{
+public:
+
+  /**
+   * Constructor, reference to the system whose timesteps we are
+   * storing, and the maximum number of snapshots to keep in memory
+   * during the forward march.  At least two snapshots (the initial
+   * condition and the most recent step) are always retained, so
+   * n_checkpoints must be at least 2.
+   */
+  CheckpointSolutionHistory(System & system_, unsigned int n_checkpoints);
+
+  /**
+   * Destructor
+   */
+  ~CheckpointSolutionHistory();
+
+  /**
+   * Virtual function store which we will be overriding to store timesteps
+   */
+  virtual void store(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Virtual function retrieve which we will be overriding to retrieve
+   * timesteps, recomputing from the nearest earlier checkpoint when
+   * the requested instant is not held in memory
+   */
+  virtual void retrieve(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Virtual function erase which we will be overriding to erase timesteps
+   */
+  virtual void erase(Real time) override;
+
+  /**
+   * Definition of the clone function needed for the setter function.
+   * The clone starts with an empty history and no substep callback.
+   */
+  virtual std::unique_ptr<SolutionHistory > clone() const override
+  {
+    return libmesh_make_unique<CheckpointSolutionHistory>(_system, _n_checkpoints);
+  }
+
+  /**
+   * Set the callback used to recompute thinned-away timesteps.  The
+   * callback must advance the system by exactly one forward step of
+   * size _system.deltat, mirroring one iteration of the user's
+   * forward timestep loop; typically it localizes any cached
+   * old-solution data, calls solve() and then advance_timestep() on
+   * the time solver.  It is invoked only after the primal state at
+   * the start of the step has been restored into the System and
+   * _system.time and deltat have been set accordingly.
+   */
+  void set_forward_substep (std::function<void()> substep)
+  { _forward_substep = substep; }
+
+private:
+
+  /**
+   * \returns \p true if a snapshot within TOLERANCE of time is
+   * currently held in memory.
+   */
+  bool have_snapshot(Real time) const;
+
+  /**
+   * \returns the index in times of the entry within TOLERANCE of
+   * time, erroring if there is none.
+   */
+  std::size_t locate_time(const std::vector<Real> & times, Real time) const;
+
+  /**
+   * Discards interior snapshots until we are back under the
+   * checkpoint budget, always erasing the snapshot whose removal
+   * creates the smallest merged gap in step index.
+   */
+  void thin_snapshots();
+
+  /**
+   * Restores the nearest checkpoint at or before time and recomputes
+   * forward steps via the substep callback until the system reaches
+   * time, snapshotting each recomputed step along the way.
+   */
+  void replay_to(Real time);
+
+  // The snapshots currently held in memory
+  MemorySolutionHistory _snapshots;
+
+  // Every forward time instant we have been asked to store, in
+  // order; this is the full trajectory, used both to recover
+  // adaptive deltats and to schedule replays
+  std::vector<Real> _all_times;
+
+  // The subset of _all_times whose snapshots are currently in memory
+  std::vector<Real> _snapshot_times;
+
+  // Maximum number of snapshots to keep during the forward march
+  unsigned int _n_checkpoints;
+
+  // Callback advancing the system by one forward step, used to
+  // recompute thinned-away segments
+  std::function<void()> _forward_substep;
+
+  // True while we are recomputing a segment, which suppresses
+  // thinning so the replayed steps survive until the adjoint sweep
+  // consumes them
+  bool _replaying;
+
+  // A system reference
+  System & _system;
+};
+
+} // end namespace libMesh
+
+#endif // LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
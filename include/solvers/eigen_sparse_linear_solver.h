@@ -122,6 +122,33 @@ public:
          const double tol,
          const unsigned int m_its) override;
 
+  /**
+   * Factors \p matrix_in with Eigen's SparseLU immediately and caches
+   * the factorization, so that repeated apply() calls can reuse it.
+   * Useful when a system must be factored once and then solved for
+   * many right-hand sides.
+   *
+   * Like solve(), this records success or failure for retrieval via
+   * get_converged_reason() rather than erroring on a singular matrix.
+   */
+  void factor (SparseMatrix<T> & matrix_in);
+
+  /**
+   * Solves with the factorization built by the last factor() call,
+   * redoing the numerical factorization first only if the operator
+   * has been marked dirty via mark_operator_dirty().
+   */
+  std::pair<unsigned int, Real>
+  apply (NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in);
+
+  /**
+   * Tells the solver that the entries of the matrix passed to
+   * factor() have changed, so the factorization must be redone before
+   * its next use.
+   */
+  void mark_operator_dirty () { _operator_dirty = true; }
+
   /**
    * \returns The solver's convergence flag
    */
@@ -140,6 +167,25 @@ private:
    */
   Eigen::ComputationInfo _comp_info;
 
+  /**
+   * The SparseLU factorization built by factor() or by the last
+   * SPARSELU solve().  Kept as a member so it can be reused across
+   * many right-hand side evaluations without refactoring.
+   */
+  Eigen::SparseLU<EigenSM> _sparse_lu;
+
+  /**
+   * The matrix the cached factorization was built from, if any; used
+   * to detect when the factorization may be reused.
+   */
+  EigenSparseMatrix<T> * _factored_matrix;
+
+  /**
+   * Set by mark_operator_dirty(): the entries of the factored matrix
+   * have changed, so the cached factorization is stale.
+   */
+  bool _operator_dirty;
+
   /**
    * Static map between Eigen ComputationInfo enumerations and libMesh
    * LinearConvergenceReason enumerations.
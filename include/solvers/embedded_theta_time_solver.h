@@ -0,0 +1,136 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_EMBEDDED_THETA_TIME_SOLVER_H
+#define LIBMESH_EMBEDDED_THETA_TIME_SOLVER_H
+
+// Local includes
+#include "libmesh/adaptive_time_solver.h"
+
+// C++ includes
+
+namespace libMesh
+{
+
+// Forward declarations
+class System;
+
+/**
+ * This class wraps a theta-method UnsteadySolver (EulerSolver or
+ * Euler2Solver) and adapts future timestep lengths from an embedded
+ * error estimate, at the cost of a single core solve per accepted
+ * step.
+ *
+ * Where TwostepTimeSolver estimates error by re-solving each step
+ * with two half steps, this class estimates the theta method's
+ * leading local truncation error, (1/2 - theta) dt^2 u'', from the
+ * difference between the difference-quotient rates of the two most
+ * recent steps - quantities the solve has already produced.  The
+ * first step after a (re)start has no rate history and is accepted
+ * unconditionally; every subsequent step pays no extra solves for its
+ * estimate.
+ *
+ * At theta == 1/2 the leading error term vanishes and a sharp
+ * estimate would need a third derivative we keep no history for; the
+ * same rate difference is used with a conservative 1/12 coefficient
+ * instead.
+ *
+ * Currently this class only works on fully coupled Systems
+ *
+ * This class is part of the new DifferentiableSystem framework,
+ * which is still experimental.  Users of this framework should
+ * beware of bugs and future API changes.
+ *
+ * \author Roy H. Stogner
+ * \date 2026
+ */
+class EmbeddedThetaTimeSolver : public AdaptiveTimeSolver
+{
+public:
+  /**
+   * The parent class
+   */
+  typedef AdaptiveTimeSolver Parent;
+
+  /**
+   * Constructor. Requires a reference to the system
+   * to be solved.
+   */
+  explicit
+  EmbeddedThetaTimeSolver (sys_type & s);
+
+  /**
+   * Destructor.
+   */
+  ~EmbeddedThetaTimeSolver ();
+
+  virtual void init() override;
+
+  virtual void solve() override;
+
+  virtual void retrieve_timestep() override;
+
+  /**
+   * This method is passed on to the core_time_solver; unlike
+   * TwostepTimeSolver we take single whole steps, so no substep
+   * bookkeeping is needed here.
+   */
+  virtual std::pair<unsigned int, Real> adjoint_solve (const QoISet & qoi_indices) override;
+
+  /**
+   * This method is passed on to the core_time_solver
+   */
+  virtual void integrate_qoi_timestep() override;
+
+  /**
+   * This method is passed on to the core_time_solver
+   */
+  virtual void integrate_adjoint_sensitivity(const QoISet & qois, const ParameterVector & parameter_vector, SensitivityData & sensitivities) override;
+
+  /**
+   * This method is passed on to the core_time_solver
+   */
+  virtual void integrate_adjoint_refinement_error_estimate(AdjointRefinementEstimator & adjoint_refinement_error_estimator, ErrorVector & QoI_elementwise_error) override;
+
+protected:
+
+  /**
+   * \returns The theta of the core EulerSolver or Euler2Solver;
+   * errors out for any other core solver, whose truncation error the
+   * embedded estimate would misjudge.
+   */
+  Real core_theta () const;
+
+  /**
+   * Whether "_embedded_theta_old_rate" holds a usable rate from the
+   * previously accepted step.
+   */
+  bool _have_old_rate;
+
+  /**
+   * The deltat over which the stored old rate was computed.
+   */
+  Real _old_rate_deltat;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_EMBEDDED_THETA_TIME_SOLVER_H
@@ -30,6 +30,7 @@
 
 // C++ includes
 #include <list>
+#include <thread>
 
 namespace libMesh
 {
@@ -102,6 +103,9 @@ private:
   // not matching a given time key implies an error.
   void find_stored_entry(Real time, bool storing = false);
 
+  // Joins any outstanding background read-ahead thread
+  void wait();
+
   // A system reference
   System & _system ;
 
@@ -120,6 +124,13 @@ private:
    * A vector of pointers to vectors holding the adjoint solution at the last time step
    */
   std::vector< std::unique_ptr<NumericVector<Number>> > dual_solution_copies;
+
+  /**
+   * Background read-ahead thread started by retrieve() to warm the OS
+   * file cache with the next solution file, joined by wait() or the
+   * destructor
+   */
+  std::thread _prefetch_thread;
 };
 
 } // end namespace libMesh
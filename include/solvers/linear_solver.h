@@ -23,9 +23,11 @@
 // Local includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/enum_subset_solve_mode.h" // SUBSET_ZERO
+#include "libmesh/id_types.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/libmesh.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/solver_telemetry.h"
 
 #ifdef LIBMESH_FORWARD_DECLARE_ENUMS
 namespace libMesh
@@ -163,6 +165,19 @@ public:
   virtual void restrict_solve_to (const std::vector<unsigned int> * const dofs,
                                   const SubsetSolveMode subset_solve_mode=SUBSET_ZERO);
 
+  /**
+   * After calling this method, all successive solves will be
+   * performed on the reordered system defined by \p permutation,
+   * which must hold, for each locally owned dof, the id it takes in
+   * the solve ordering -- e.g. the output of
+   * DofMap::local_layout_permutation().  The reordering may not move
+   * dofs between processors.  Solution and right hand side vectors
+   * are permuted on entry and restored on exit, so callers keep
+   * assembling in the original ordering.  This mode can be disabled
+   * by calling this method with \p permutation being a \p nullptr.
+   */
+  virtual void solve_in_permuted_order (const std::vector<dof_id_type> * const permutation);
+
   /**
    * This function calls the solver \p _solver_type preconditioned
    * with the \p _preconditioner_type preconditioner.
@@ -267,6 +282,12 @@ public:
    */
   void set_solver_configuration(SolverConfiguration & solver_configuration);
 
+  /**
+   * \returns The always-on convergence telemetry ring buffer for
+   * this solver.
+   */
+  SolverTelemetry & telemetry() { return _telemetry; }
+
 protected:
 
 
@@ -303,6 +324,12 @@ protected:
    * to set parameters like solver type, tolerances and iteration limits.
    */
   SolverConfiguration * _solver_configuration;
+
+  /**
+   * Always-on ring buffer of per-iteration convergence samples,
+   * dumped on diverged solves for post-mortem diagnosis.
+   */
+  SolverTelemetry _telemetry;
 };
 
 
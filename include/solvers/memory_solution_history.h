@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <list>
+#include <vector>
 
 namespace libMesh
 {
@@ -95,6 +96,16 @@ private:
   // The stored solutions iterator
   stored_solutions_iterator stored_sols;
 
+  // Vectors retired from erased timesteps, kept around for reuse by
+  // later store() calls so a long time march stops allocating once it
+  // reaches steady state
+  std::vector<std::unique_ptr<NumericVector<Number>>> _vector_pool;
+
+  // A helper function producing a copy of vec, reusing a retired
+  // vector from the pool when a compatible one is available instead
+  // of allocating a fresh clone
+  std::unique_ptr<NumericVector<Number>> duplicate_vector(const NumericVector<Number> & vec);
+
   // A helper function to locate entries at a given time
   // Behaviour depends on whether we are calling this function
   // while storing or retrieving/erasing entries.
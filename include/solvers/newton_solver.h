@@ -142,6 +142,29 @@ public:
    */
   double linear_tolerance_multiplier;
 
+  /**
+   * The maximum number of consecutive Newton iterations which may
+   * reuse (freeze) the most recently assembled Jacobian before a
+   * fresh assembly is forced.  While the Jacobian is frozen the
+   * linear solver is also told to reuse its preconditioner, so mildly
+   * nonlinear problems skip both the assembly and the setup cost on
+   * frozen iterations.
+   * It is currently set to 0 by default, which reassembles on every
+   * iteration.
+   */
+  unsigned int max_jacobian_reuse;
+
+  /**
+   * Safeguard for Jacobian reuse: if an iteration taken with a frozen
+   * Jacobian fails to reduce the residual by at least this factor,
+   * i.e. if current_residual > jacobian_reuse_stagnation *
+   * last_residual, then a fresh Jacobian is assembled on the next
+   * iteration even if the freeze window has not been exhausted.
+   * It is currently set to 0.5 by default; set it to a value of 1 or
+   * more to disable the safeguard.
+   */
+  Real jacobian_reuse_stagnation;
+
 protected:
 
   /**
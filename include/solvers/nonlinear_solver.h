@@ -26,6 +26,7 @@
 #include "libmesh/nonlinear_implicit_system.h"
 #include "libmesh/libmesh.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/solver_telemetry.h"
 
 #ifdef LIBMESH_FORWARD_DECLARE_ENUMS
 namespace libMesh
@@ -362,6 +363,12 @@ public:
    */
   void set_solver_configuration(SolverConfiguration & solver_configuration);
 
+  /**
+   * \returns The always-on convergence telemetry ring buffer for
+   * this solver.
+   */
+  SolverTelemetry & telemetry() { return _telemetry; }
+
 protected:
   /**
    * A reference to the system we are solving.
@@ -383,6 +390,12 @@ protected:
    * to set parameters like solver type, tolerances and iteration limits.
    */
   SolverConfiguration * _solver_configuration;
+
+  /**
+   * Always-on ring buffer of per-iteration convergence samples,
+   * dumped on diverged solves for post-mortem diagnosis.
+   */
+  SolverTelemetry _telemetry;
 };
 
 
@@ -426,7 +439,8 @@ NonlinearSolver<T>::NonlinearSolver (sys_type & s) :
   _system(s),
   _is_initialized (false),
   _preconditioner (nullptr),
-  _solver_configuration(nullptr)
+  _solver_configuration(nullptr),
+  _telemetry("NonlinearSolver")
 {
 }
 
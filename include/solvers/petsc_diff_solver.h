@@ -93,6 +93,21 @@ public:
    */
   virtual unsigned int solve () override;
 
+  /**
+   * Set the reuse_preconditioner flag.  When enabled, reinit() keeps
+   * the configured SNES (and so its KSP and PC) alive across mesh
+   * changes instead of destroying and rebuilding all PETSc data, and
+   * solve() asks PETSc to reapply the preconditioner hierarchy built
+   * for the previous operator (an AMG coarse grid ladder, ILU
+   * factors, ...) whenever the dof distribution is unchanged.  After
+   * a mesh change which alters the dof distribution the hierarchy
+   * cannot be reused and is rebuilt in full at the next solve.
+   *
+   * This is off by default; it is profitable when the Jacobian
+   * changes slowly between solves, e.g. across small adaptive steps.
+   */
+  void reuse_preconditioner (bool reuse);
+
 protected:
 
   /**
@@ -100,6 +115,19 @@ protected:
    */
   WrappedPetsc<SNES> _snes;
 
+  /**
+   * Whether to hang on to PETSc solver state, including the
+   * preconditioner hierarchy where possible, across reinit().
+   */
+  bool _reuse_preconditioner;
+
+  /**
+   * The dof distribution our PETSc data was last set up for, so
+   * solve() can tell whether the old preconditioner is still usable.
+   */
+  dof_id_type _setup_n_dofs;
+  dof_id_type _setup_n_local_dofs;
+
   /**
    * Wrapper object for interacting with PetscDM
    */
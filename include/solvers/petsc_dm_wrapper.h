@@ -149,6 +149,14 @@ namespace libMesh
      */
     std::vector<std::unique_ptr<PetscMatrix<Number>>> _subpmtx_vec;
 
+    /**
+     * Vector of restriction matrixes for all grid levels, assembled
+     * as the transposes of the projection matrixes.  These are C++
+     * objects, they are cleaned up automatically by their
+     * destructors.
+     */
+    std::vector<std::unique_ptr<PetscMatrix<Number>>> _rmtx_vec;
+
     /**
      * Vector of internal PetscDM context structs for all grid levels
      * Pointers to these C++ objects are passed to DMShellSetContext(),
@@ -147,6 +147,15 @@ public:
   virtual void restrict_solve_to (const std::vector<unsigned int> * const dofs,
                                   const SubsetSolveMode subset_solve_mode=SUBSET_ZERO) override;
 
+  /**
+   * After calling this method, all successive solves will be
+   * performed on the reordered system defined by \p permutation; see
+   * LinearSolver::solve_in_permuted_order().  This mode cannot be
+   * combined with restrict_solve_to(), and can be disabled by
+   * calling this method with \p permutation being a \p nullptr.
+   */
+  virtual void solve_in_permuted_order (const std::vector<dof_id_type> * const permutation) override;
+
   /**
    * Call the Petsc solver.  It calls the method below, using the
    * same matrix for the system and preconditioner matrices.
@@ -220,6 +229,49 @@ public:
          const double tol,
          const unsigned int m_its) override;
 
+  /**
+   * First half of the split-phase solve API: installs \p matrix_in as
+   * both the system and preconditioning operator and performs the
+   * (potentially expensive) preconditioner setup -- e.g. an ILU
+   * factorization or an AMG hierarchy -- immediately, so that
+   * repeated apply() calls can reuse it.  Useful in linear transient
+   * runs with fixed timestep, where the operator is assembled once
+   * and only the right hand side changes.
+   *
+   * \note Subset solves selected via restrict_solve_to() are not
+   * supported by this interface; use solve() for those.
+   */
+  void factor (SparseMatrix<T> & matrix_in);
+
+  /**
+   * Second half of the split-phase solve API: solves for \p
+   * solution_in using the operator and preconditioner set up by the
+   * last factor() call, redoing the setup first only if the operator
+   * has been marked dirty via mark_operator_dirty().  When warm
+   * starts are enabled the incoming content of \p solution_in --
+   * typically the previous timestep's solution -- seeds the Krylov
+   * iteration.
+   */
+  std::pair<unsigned int, Real>
+  apply (NumericVector<T> & solution_in,
+         NumericVector<T> & rhs_in,
+         const double tol,
+         const unsigned int m_its);
+
+  /**
+   * Tells the split-phase solve API that the operator installed by
+   * factor() has changed, so the next apply() call must redo the
+   * preconditioner setup.
+   */
+  void mark_operator_dirty () { _operator_dirty = true; }
+
+  /**
+   * Enables or disables warm starts for apply(): when enabled (the
+   * default), the incoming solution vector seeds the Krylov
+   * iteration rather than a zero initial guess.
+   */
+  void use_warm_starts (bool warm) { _use_warm_starts = warm; }
+
   /**
    * \returns The raw PETSc preconditioner context pointer.
    *
@@ -265,6 +317,13 @@ private:
    */
   void set_petsc_solver_type ();
 
+  /**
+   * Records the final iteration count, residual norm, and KSP
+   * converged reason in the telemetry ring, dumping the ring to
+   * \p libMesh::err if the solve diverged.
+   */
+  void record_solve_telemetry (PetscInt its, PetscReal final_resid);
+
   /**
    * Internal function if shell matrix mode is used.
    */
@@ -303,6 +362,13 @@ private:
    */
   WrappedPetsc<IS> _restrict_solve_to_is_complement;
 
+  /**
+   * PETSc index set defining the ordering used for the solve when
+   * solve_in_permuted_order() has been called, stored in PETSc's
+   * new-to-old convention.
+   */
+  WrappedPetsc<IS> _permutation_is;
+
   /**
    * \returns The local size of \p _restrict_solve_to_is.
    */
@@ -320,6 +386,24 @@ private:
    * what happens with the dofs outside the subset.
    */
   SubsetSolveMode _subset_solve_mode;
+
+  /**
+   * The matrix installed by the last factor() call, if any; apply()
+   * re-factors it when the operator has been marked dirty.
+   */
+  PetscMatrix<T> * _factored_matrix;
+
+  /**
+   * Split-phase solve API flag: the operator has changed since the
+   * last factor(), so apply() must redo the preconditioner setup.
+   */
+  bool _operator_dirty;
+
+  /**
+   * Split-phase solve API flag: seed the Krylov iteration in apply()
+   * with the incoming solution vector.
+   */
+  bool _use_warm_starts;
 };
 
 } // namespace libMesh
@@ -0,0 +1,161 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SOLVER_TELEMETRY_H
+#define LIBMESH_SOLVER_TELEMETRY_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <csignal>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A fixed-capacity ring buffer of per-iteration solver convergence
+ * samples (residual norm, iteration count, reason code, wall time),
+ * cheap enough to leave recording in production solves.  record()
+ * does no allocation or I/O after construction, so the per-iteration
+ * overhead is a handful of stores plus one clock read.
+ *
+ * The ring retains the most recent samples across solves; on a
+ * diverged solve the owning solver dumps it for a post-mortem trace
+ * without rerunning under verbose logging.  An application can also
+ * arrange a dump of every live telemetry ring by installing the
+ * signal hook via enable_signal_dump(): the handler only sets a flag,
+ * and the next record() call performs the actual (signal-unsafe)
+ * stream output.
+ *
+ * \author Roy H. Stogner
+ * \date 2020
+ * \brief Bounded ring buffer of solver convergence samples.
+ */
+class SolverTelemetry
+{
+public:
+
+  /**
+   * One recorded iteration.  \p reason is a solver-specific
+   * convergence reason code (e.g. a KSPConvergedReason or
+   * SNESConvergedReason cast to int), 0 while still iterating.
+   */
+  struct Sample
+  {
+    double wall_time;
+    Real residual_norm;
+    int iteration;
+    int reason;
+  };
+
+  /**
+   * Constructor.  \p solver_name labels dumps; \p capacity bounds the
+   * number of retained samples.  Storage is allocated up front so
+   * that record() never allocates.
+   */
+  explicit SolverTelemetry (std::string solver_name,
+                            std::size_t capacity = 1024);
+
+  /**
+   * Destructor; removes this ring from the signal-dump registry.
+   */
+  ~SolverTelemetry ();
+
+  SolverTelemetry (const SolverTelemetry &) = delete;
+  SolverTelemetry & operator= (const SolverTelemetry &) = delete;
+
+  /**
+   * Appends a sample, overwriting the oldest when full.  Also
+   * services any pending signal-requested dump.
+   */
+  void record (int iteration,
+               Real residual_norm,
+               int reason = 0);
+
+  /**
+   * Discards all retained samples.
+   */
+  void clear ();
+
+  /**
+   * \returns The number of samples currently retained.
+   */
+  std::size_t n_samples () const { return _count; }
+
+  /**
+   * \returns Retained sample \p i, with 0 the oldest still in the
+   * ring.
+   */
+  const Sample & sample (std::size_t i) const;
+
+  /**
+   * Writes the retained samples to \p os, oldest first.
+   */
+  void dump (std::ostream & os) const;
+
+  /**
+   * Writes every live telemetry ring to \p os.
+   */
+  static void dump_all (std::ostream & os);
+
+  /**
+   * Installs a handler for \p signum which requests a dump_all() to
+   * libMesh::err; the dump itself happens from the next record()
+   * call, keeping the handler async-signal-safe.  Not installed by
+   * default.
+   */
+  static void enable_signal_dump (int signum);
+
+private:
+
+  std::string _solver_name;
+
+  /**
+   * Preallocated sample storage; \p _next is the slot the next
+   * record() will overwrite and \p _count the number of valid
+   * entries.
+   */
+  std::vector<Sample> _ring;
+  std::size_t _next;
+  std::size_t _count;
+
+  /**
+   * Reference point for Sample::wall_time, taken at construction.
+   */
+  double _start_time;
+
+  /**
+   * Set from the signal handler, serviced by record().
+   */
+  static volatile std::sig_atomic_t _dump_requested;
+
+  /**
+   * The async-signal-safe handler installed by enable_signal_dump().
+   */
+  static void request_dump (int signum);
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SOLVER_TELEMETRY_H
@@ -92,6 +92,26 @@ public:
    */
   virtual void integrate_adjoint_refinement_error_estimate(AdjointRefinementEstimator & adjoint_refinement_error_estimator, ErrorVector & QoI_elementwise_error) override;
 
+  /**
+   * If this is set greater than 1, the double-length comparison solve
+   * used for error estimation and timestep adaptation only runs on
+   * every error_check_interval-th call to solve(); the intervening
+   * calls just march the accepted half-step chain at the current
+   * deltat.  Since the comparison solve is roughly a third of the
+   * work of a checked step, large intervals approach a 1.5x speedup,
+   * at the price of reacting to error growth up to
+   * error_check_interval-1 steps late.  The default of 1 checks every
+   * step, reproducing the historical behavior.
+   */
+  unsigned int error_check_interval;
+
+protected:
+
+  /**
+   * Number of timesteps remaining before the next double-length
+   * comparison solve.
+   */
+  unsigned int _steps_to_next_error_check;
 };
 
 
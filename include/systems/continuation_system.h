@@ -150,6 +150,63 @@ public:
    */
   double initial_newton_tolerance;
 
+  /**
+   * Abstract base class for the parameter-dependent coefficients
+   * theta_q(lambda) of an affine decomposition of the residual,
+   * \f$ G(u,\lambda) = \sum_q \theta_q(\lambda) G_q(u) \f$,
+   * mirroring the theta expansion pattern used by the reduced basis
+   * code.  Subclasses must provide the coefficient and its derivative
+   * with respect to the continuation parameter.
+   */
+  class AffineTheta
+  {
+  public:
+    virtual ~AffineTheta () = default;
+
+    /**
+     * \returns \f$ \theta_q \f$ evaluated at \p lambda.
+     */
+    virtual Number evaluate (Real lambda) = 0;
+
+    /**
+     * \returns \f$ d\theta_q/d\lambda \f$ evaluated at \p lambda.
+     */
+    virtual Number evaluate_deriv (Real lambda) = 0;
+  };
+
+  /**
+   * Registers one term of an affine decomposition of the residual.
+   * The derived class must assemble the parameter-independent piece
+   * \f$ G_q(u) \f$, for q = current_affine_term(), when rhs_mode ==
+   * AffineTerm.  Once at least one term has been registered, the
+   * continuation algorithm assembles the pieces once per Newton
+   * iterate and recombines the cached pieces (weighted by theta_q or
+   * theta_q') instead of re-assembling the full residual or G_Lambda
+   * vectors, which makes parameter-only updates nearly assembly-free.
+   *
+   * \returns The index q of the newly-registered term.
+   */
+  unsigned int add_affine_term (AffineTheta & theta);
+
+  /**
+   * \returns true if any affine terms have been registered.
+   */
+  bool have_affine_decomposition () const { return !_affine_thetas.empty(); }
+
+  /**
+   * \returns The index q of the affine term which the derived class
+   * should assemble when rhs_mode == AffineTerm.
+   */
+  unsigned int current_affine_term () const { return _current_affine_term; }
+
+  /**
+   * Marks the cached affine residual pieces as stale.  This happens
+   * automatically whenever the continuation algorithm updates the
+   * solution; call it manually if you modify the solution vector
+   * outside this class.
+   */
+  void invalidate_affine_residuals () { _affine_residuals_current = false; }
+
   /**
    * Stores the current solution and continuation parameter
    * (as "previous_u" and "old_continuation_parameter") for later referral.
@@ -286,9 +343,15 @@ protected:
    *     Fu(i) += ... // derivative wrt control parameter
    *     break;
    *   }
+   *
+   * If affine terms have been registered with add_affine_term(), the
+   * assembly routine will also be called with rhs_mode == AffineTerm,
+   * in which case it should assemble only the parameter-independent
+   * piece G_q(u) for q = current_affine_term().
    */
   enum RHS_Mode {Residual,
-                 G_Lambda};
+                 G_Lambda,
+                 AffineTerm};
 
   RHS_Mode rhs_mode;
 
@@ -332,6 +395,18 @@ private:
    */
   void apply_predictor();
 
+  /**
+   * Re-assembles the cached affine residual pieces G_q at the current
+   * solution iterate, if they are stale.
+   */
+  void update_affine_residuals();
+
+  /**
+   * Recombines the cached affine pieces into rhs, weighting each by
+   * theta_q(lambda) or, if \p derivative is true, theta_q'(lambda).
+   */
+  void combine_affine_residuals(bool derivative);
+
   /**
    * Extra work vectors used by the continuation algorithm.
    * These are added to the system by the init_data() routine.
@@ -419,6 +494,27 @@ private:
    * Loop counter for nonlinear (Newton) iteration loop.
    */
   unsigned int newton_step;
+
+  /**
+   * The coefficient functors for the registered affine terms.
+   */
+  std::vector<AffineTheta *> _affine_thetas;
+
+  /**
+   * Cached assembled residual pieces G_q, stored as extra system
+   * vectors added by add_affine_term().
+   */
+  std::vector<NumericVector<Number> *> _affine_residuals;
+
+  /**
+   * Whether the cached affine pieces match the current solution iterate.
+   */
+  bool _affine_residuals_current;
+
+  /**
+   * Index of the affine term currently being assembled.
+   */
+  unsigned int _current_affine_term;
 };
 
 } // namespace libMesh
@@ -238,6 +238,39 @@ public:
   template<typename OutputShape>
   void get_neighbor_side_fe( unsigned int var, FEGenericBase<OutputShape> *& fe ) const;
 
+  /**
+   * Enable or disable the shared face data cache.  When enabled, the
+   * first of a face's two elements to be reinited in an assembly
+   * sweep stores the face's quadrature weights together with the
+   * quadrature points' preimages on the other element's matching side
+   * and in its own interior; when the sweep later reaches the face's
+   * other element, side_fe_reinit() reinits that element's side FE
+   * objects at the stored side points and neighbor_side_fe_reinit()
+   * reuses the stored interior points outright, skipping the
+   * per-point inverse mapping into the neighbor.  Both elements then
+   * see the face's quadrature points in one shared ordering.
+   *
+   * The cache is keyed on element ids, so it must be emptied with
+   * clear_shared_face_data() at the start of every assembly sweep,
+   * and again whenever the mesh moves.  Faces between elements of
+   * unequal refinement level are never cached.
+   */
+  void set_use_shared_face_data (bool use)
+  { _use_shared_face_data = use; }
+
+  /**
+   * \returns Whether the shared face data cache is in use.
+   */
+  bool use_shared_face_data () const
+  { return _use_shared_face_data; }
+
+  /**
+   * Drops all cached face data.  Call this at the start of each
+   * assembly sweep when the shared face data cache is in use.
+   */
+  void clear_shared_face_data ()
+  { _shared_face_data.clear(); }
+
 private:
 
   /**
@@ -294,6 +327,52 @@ private:
    * assembled and should be used in the global matrix assembly.
    */
   bool _dg_terms_active;
+
+  /**
+   * Boolean flag to indicate whether the shared face data cache
+   * should be consulted and filled during side reinits.
+   */
+  bool _use_shared_face_data;
+
+  /**
+   * The data stored for one interior face by the first of its two
+   * elements to be reinited in an assembly sweep, for reuse by the
+   * second.  All vectors follow the ordering of the filling element's
+   * side quadrature rule.
+   */
+  struct SharedFaceData
+  {
+    /**
+     * id of the element whose neighbor_side_fe_reinit() filled this
+     * entry.
+     */
+    dof_id_type filled_by_elem;
+
+    /**
+     * Quadrature weights of the filling element's side quadrature
+     * rule.
+     */
+    std::vector<Real> weights;
+
+    /**
+     * Preimages of the face quadrature points on the reference side
+     * of the consuming element, used to reinit its side FE objects.
+     */
+    std::vector<Point> side_reference_points;
+
+    /**
+     * Preimages of the face quadrature points in the filling
+     * element's reference interior, used to reinit the consuming
+     * element's neighbor side FE objects.
+     */
+    std::vector<Point> volume_reference_points;
+  };
+
+  /**
+   * Cached face data, keyed on the sorted pair of ids of the elements
+   * adjacent to each face.
+   */
+  std::map<std::pair<dof_id_type, dof_id_type>, SharedFaceData> _shared_face_data;
 };
 
 template<typename OutputShape>
@@ -277,6 +277,26 @@ public:
     return *(_elem_subresiduals[var]);
   }
 
+  /**
+   * \returns \p true if this context handles per-element Jacobian
+   * storage: resizing and repositioning it when moving to a new
+   * element.  Defaults to \p true; residual-only assembly sweeps
+   * (e.g. line search re-evaluations) disable it to skip the
+   * n_dofs^2 zeroing per element.
+   */
+  bool have_local_matrices () const
+  { return _have_local_matrices; }
+
+  /**
+   * Enables or disables per-element Jacobian storage handling; see
+   * have_local_matrices().  With local matrices disabled the element
+   * Jacobian and its subviews are stale and must not be read or
+   * written, so this is only valid for sweeps which neither request a
+   * Jacobian nor apply heterogeneous constraints.
+   */
+  void set_have_local_matrices (bool have_them)
+  { _have_local_matrices = have_them; }
+
   /**
    * Const accessor for element Jacobian.
    */
@@ -662,6 +682,12 @@ private:
    */
   bool _is_adjoint;
 
+  /**
+   * Whether we handle per-element Jacobian storage; see
+   * have_local_matrices().
+   */
+  bool _have_local_matrices;
+
 };
 
 } // namespace libMesh
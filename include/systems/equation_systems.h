@@ -526,6 +526,56 @@ public:
    **/
   bool refine_in_reinit_flag() { return this->_refine_in_reinit; }
 
+  /**
+   * Configures the memory budget governing spill_aged_vectors(): the
+   * maximum number of bytes per processor the transient history
+   * vectors of all systems may keep resident, along with the
+   * directory their scratch files are written to.  A budget of zero
+   * (the default) disables spilling.
+   **/
+  void set_vector_spill_policy (std::size_t max_resident_bytes,
+                                std::string scratch_directory = ".");
+
+  /**
+   * Spills the transient history vectors of all systems to scratch
+   * files, oldest first, until the bytes they keep resident on this
+   * processor fall within the configured budget.  Spilled vectors are
+   * reloaded automatically by System::update(), so calling this after
+   * each time step advance keeps aged states on disk between steps.
+   **/
+  void spill_aged_vectors ();
+
+  /**
+   * Declares that system \p dependent may only be initialized after
+   * system \p prerequisite, e.g. because its initialization reads the
+   * other system's dof layout.  Both systems must already have been
+   * added.  Systems with no declared dependencies are considered
+   * independent of each other; the shared mesh setup always precedes
+   * every system's initialization.
+   **/
+  void add_system_dependency (const std::string & dependent,
+                              const std::string & prerequisite);
+
+  /**
+   * Enables or disables multithreaded system initialization.  While
+   * enabled, init() (and reinit() for newly added systems)
+   * initializes mutually independent systems concurrently, one
+   * thread per system, so multi-system setup time approaches that of
+   * the slowest system; declared dependencies are still honored.
+   *
+   * \note Each system's initialization makes parallel communication
+   * and solver-package calls from its own thread, so this requires a
+   * thread-safe MPI (or a single processor) and thread-safe linear
+   * algebra.  It is therefore disabled by default.
+   **/
+  void set_parallel_system_init (bool enabled)
+  { _parallel_system_init = enabled; }
+
+  /**
+   * \returns Whether multithreaded system initialization is enabled.
+   **/
+  bool parallel_system_init () const { return _parallel_system_init; }
+
   /**
    * Handle any mesh changes and project any solutions onto the
    * updated mesh.
@@ -539,6 +589,13 @@ public:
    */
   virtual void reinit_systems ();
 
+  /**
+   * Initializes every not-yet-initialized system, scheduling them as
+   * tasks in dependency-graph order; mutually independent systems
+   * run concurrently when parallel_system_init() is enabled.
+   */
+  void init_systems ();
+
   /**
    * Data structure holding arbitrary parameters.
    */
@@ -574,6 +631,31 @@ protected:
    */
   bool _refine_in_reinit;
 
+  /**
+   * The maximum number of bytes per processor of transient history
+   * vector storage spill_aged_vectors() will leave resident; zero
+   * disables spilling.
+   */
+  std::size_t _vector_spill_budget;
+
+  /**
+   * The directory spill_aged_vectors() writes scratch files to.
+   */
+  std::string _vector_spill_directory;
+
+  /**
+   * Declared initialization prerequisites, keyed by the dependent
+   * system's name.
+   */
+  std::multimap<std::string, std::string> _system_dependencies;
+
+  /**
+   * Flag for whether init_systems() may initialize independent
+   * systems on concurrent threads.
+   * Default value: false
+   */
+  bool _parallel_system_init;
+
   /**
    * Flag for whether to enable default ghosting on newly added Systems.
    * Default value: true
@@ -0,0 +1,212 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_EVENT_TRIGGERED_OUTPUT_H
+#define LIBMESH_EVENT_TRIGGERED_OUTPUT_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class EquationSystems;
+class ExodusII_IO;
+template <typename T> class NumericVector;
+
+/**
+ * An event-driven output controller for \p EquationSystems.
+ *
+ * Writing every timestep to disk "just in case" pays I/O for data
+ * which is usually discarded.  This controller instead keeps a bounded
+ * in-memory ring of recent solution snapshots (cloned solution
+ * vectors) and only flushes them to an ExodusII file when a trigger
+ * fires: a quantity-of-interest excursion, or a user-supplied trigger
+ * function.  Because the whole ring is written retrospectively, the
+ * output contains high-frequency data leading up to the event at a
+ * small fraction of the I/O of unconditional writes.
+ *
+ * Typical use is to call \p capture() once per timestep after the
+ * solve; the controller buffers the solution and flushes automatically
+ * when a trigger fires.  Call \p flush() directly to force out
+ * whatever is currently buffered (e.g. at the end of a simulation).
+ *
+ * \author Benjamin S. Kirk
+ * \date 2020
+ * \brief Buffers solution snapshots, writing them only around events.
+ */
+class EventTriggeredOutput
+{
+public:
+
+  /**
+   * Constructor.  Snapshots beyond the most recent \p max_snapshots
+   * are silently dropped from the ring.
+   */
+  explicit
+  EventTriggeredOutput (EquationSystems & es,
+                        unsigned int max_snapshots = 10);
+
+  /**
+   * Destructor.  Any still-buffered snapshots are discarded, not
+   * written.
+   */
+  virtual ~EventTriggeredOutput ();
+
+  /**
+   * Attaches the ExodusII file which flushed snapshots are appended
+   * to, one Exodus timestep per snapshot.
+   */
+  void attach_exodus (ExodusII_IO & exodus_io,
+                      const std::string & filename);
+
+  /**
+   * Attaches a user trigger function, evaluated on every \p capture()
+   * with the captured time; returning \p true flushes the ring.  Error
+   * indicator spikes or any other application-specific criterion can
+   * be monitored this way.
+   */
+  void attach_trigger_function (bool fptr(EquationSystems & es,
+                                          Real time));
+
+  /**
+   * Fires a flush whenever qoi number \p qoi_index of system
+   * \p system_name drifts more than \p excursion from its baseline
+   * value.  The baseline is the qoi value seen by the first
+   * \p capture() after construction or after a flush.
+   */
+  void monitor_qoi (const std::string & system_name,
+                    unsigned int qoi_index,
+                    Real excursion);
+
+  /**
+   * Buffers a snapshot of every system's solution at time \p time,
+   * then evaluates the triggers.
+   *
+   * \returns \p true if a trigger fired and the ring was flushed.
+   */
+  bool capture (Real time);
+
+  /**
+   * Writes out and empties the ring, oldest snapshot first.
+   *
+   * \returns The number of snapshots written.
+   */
+  unsigned int flush ();
+
+  /**
+   * \returns The number of snapshots currently buffered.
+   */
+  unsigned int n_buffered () const
+  { return cast_int<unsigned int>(_ring.size()); }
+
+  /**
+   * \returns The total number of snapshots written so far.
+   */
+  unsigned int n_written () const { return _n_written; }
+
+protected:
+
+  /**
+   * One buffered entry of the ring: the capture time and a cloned
+   * solution vector per system.
+   */
+  struct Snapshot
+  {
+    Real time;
+    std::vector<std::unique_ptr<NumericVector<Number>>> solutions;
+  };
+
+  /**
+   * Writes a single snapshot as Exodus timestep \p timestep by
+   * temporarily swapping the buffered vectors into the systems.
+   * Subclasses may override this to target other formats, or to count
+   * writes in testing.
+   */
+  virtual void write_snapshot (Snapshot & snap, int timestep);
+
+  /**
+   * \returns \p true if any attached trigger fires at time \p time.
+   */
+  bool triggered (Real time);
+
+  /**
+   * The EquationSystems being monitored.
+   */
+  EquationSystems & _es;
+
+  /**
+   * Maximum number of buffered snapshots.
+   */
+  unsigned int _max_snapshots;
+
+  /**
+   * The snapshot ring, oldest entry first.
+   */
+  std::deque<Snapshot> _ring;
+
+  /**
+   * Output target; may be \p nullptr if write_snapshot() is
+   * overridden.
+   */
+  ExodusII_IO * _exodus_io;
+
+  /**
+   * Name of the attached ExodusII file.
+   */
+  std::string _filename;
+
+  /**
+   * User trigger function, or \p nullptr.
+   */
+  bool (* _trigger_fptr) (EquationSystems & es, Real time);
+
+  /**
+   * QoI monitoring state; see monitor_qoi().
+   */
+  std::string _qoi_system;
+  unsigned int _qoi_index;
+  Real _qoi_excursion;
+  bool _monitoring_qoi;
+  bool _qoi_baseline_set;
+  Number _qoi_baseline;
+
+  /**
+   * 1-based Exodus timestep given to the next written snapshot.
+   */
+  int _next_timestep;
+
+  /**
+   * Running count of written snapshots.
+   */
+  unsigned int _n_written;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_EVENT_TRIGGERED_OUTPUT_H
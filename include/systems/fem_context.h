@@ -34,6 +34,8 @@
 // C++ includes
 #include <map>
 #include <set>
+#include <string>
+#include <vector>
 
 namespace libMesh
 {
@@ -781,6 +783,55 @@ public:
    */
   virtual void edge_fe_reinit();
 
+  /**
+   * Enables or disables the FE reinit cache.  While enabled,
+   * elem_fe_reinit() and side_fe_reinit() return immediately when
+   * asked to recompute FE data for the same element (and side), with
+   * bitwise identical node positions, as their previous call, so
+   * repeated residual evaluations on an unmoved element reuse one
+   * reinit's FE data.  This makes finite differencing for a numerical
+   * jacobian much cheaper on moving-mesh systems.
+   */
+  void set_fe_reinit_cache(bool enabled)
+  {
+    _fe_reinit_cache_enabled = enabled;
+    _cached_fe_elem = nullptr;
+    _cached_side_fe_elem = nullptr;
+  }
+
+  /**
+   * \returns \p true if the FE reinit cache is enabled.
+   */
+  bool fe_reinit_cache() const { return _fe_reinit_cache_enabled; }
+
+  /**
+   * Opens a calculation request window on every FE object this
+   * context caches, dropping their expensive differentiation tiers
+   * (second derivatives, curls, and divergences) until the matching
+   * end_calculation_request_window().  Re-request whatever data the
+   * next assembly phase needs, e.g. through the get_element_fe()
+   * objects' get_ accessors, before reinitializing on the phase's
+   * first element.
+   */
+  void begin_calculation_request_window();
+
+  /**
+   * Closes the window opened by begin_calculation_request_window(),
+   * keeping requests made inside it and restoring those dropped when
+   * it opened.
+   */
+  void end_calculation_request_window();
+
+  /**
+   * \returns One entry per calculation tier which some cached FE
+   * object tabulated but never read back since the last request
+   * window opened, each prefixed by the FE family and the context
+   * ("element", "side", or "edge") it was computed for.  Useful for
+   * auditing assembly kernels that request differentiation data they
+   * never use.
+   */
+  std::vector<std::string> unread_fe_calculations() const;
+
   /**
    * Accessor for element interior quadrature rule for the dimension of the
    * current _elem.
@@ -987,6 +1038,35 @@ public:
   void set_custom_solution(const NumericVector<Number> * custom_sol)
   { _custom_solution = custom_sol; }
 
+  /**
+   * Restricts the set of variables whose solution values
+   * pre_fe_reinit() will gather on each element.  By default every
+   * variable is gathered; physics which only read a few of many
+   * system variables can skip the rest of the localization work.
+   *
+   * Degree of freedom indices are still initialized for all
+   * variables, so residual and jacobian assembly are unaffected.
+   * Solution entries for unrequested variables are left zero, so any
+   * kernel reading an undeclared variable will get deterministically
+   * wrong answers rather than stale ones.
+   */
+  void set_requested_variables(const std::set<unsigned int> & vars)
+  { _requested_vars = vars; }
+
+  /**
+   * Restores the default behavior of gathering every variable's
+   * solution values in pre_fe_reinit().
+   */
+  void request_all_variables()
+  { _requested_vars.clear(); }
+
+  /**
+   * \returns \p true iff pre_fe_reinit() will gather solution values
+   * for variable \p var.
+   */
+  bool variable_requested(unsigned int var) const
+  { return _requested_vars.empty() || _requested_vars.count(var); }
+
   /**
    * Calls set_jacobian_tolerance() on all the FE objects controlled
    * by this class. (Actually, it calls this on the underlying)
@@ -1013,6 +1093,22 @@ public:
    */
   unsigned char edge;
 
+  /**
+   * Whether elem_fe_reinit() and side_fe_reinit() may skip
+   * recomputation when the element geometry is unchanged
+   */
+  bool _fe_reinit_cache_enabled;
+
+  /**
+   * The elements, side, and node positions the interior and side FE
+   * data were last computed for, used by the reinit cache
+   */
+  const Elem * _cached_fe_elem;
+  const Elem * _cached_side_fe_elem;
+  unsigned char _cached_fe_side;
+  std::vector<Point> _cached_fe_points;
+  std::vector<Point> _cached_side_fe_points;
+
   /**
    * Helper function for creating quadrature rules
    */
@@ -1047,6 +1143,12 @@ protected:
    */
   const NumericVector<Number> * _custom_solution;
 
+  /**
+   * Variables whose solution values pre_fe_reinit() should gather;
+   * an empty set means all of them.
+   */
+  std::set<unsigned int> _requested_vars;
+
   mutable std::unique_ptr<FEGenericBase<Real>>         _real_fe;
   mutable std::unique_ptr<FEGenericBase<RealGradient>> _real_grad_fe;
   mutable int _real_fe_derivative_level;
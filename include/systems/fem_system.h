@@ -21,11 +21,16 @@
 #define LIBMESH_FEM_SYSTEM_H
 
 // Local Includes
+#include "libmesh/dense_matrix.h"
 #include "libmesh/diff_system.h"
 #include "libmesh/fem_physics.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace libMesh
 {
@@ -140,6 +145,33 @@ public:
    */
   virtual void init_context(DiffContext &) override;
 
+  /**
+   * \returns A context from the reuse pool when one is available,
+   * building and initializing a new one otherwise.  Pooled contexts
+   * keep their FE objects and quadrature rules, so repeated
+   * assemblies (e.g. every timestep of a transient run) skip the
+   * FE/quadrature setup cost that \p build_context() pays.
+   *
+   * Pair each call with \p release_context() once the element loop
+   * is done; destroying the returned pointer instead is safe but
+   * forfeits the reuse.
+   */
+  std::unique_ptr<DiffContext> acquire_context ();
+
+  /**
+   * Returns \p context, obtained from \p acquire_context(), to the
+   * reuse pool.
+   */
+  void release_context (std::unique_ptr<DiffContext> context);
+
+  /**
+   * Discards all pooled contexts.  This is done automatically when
+   * the system gets reinitialized; call it manually after changes
+   * (e.g. swapping quadrature rules) that invalidate existing
+   * contexts.
+   */
+  void clear_context_pool ();
+
   /**
    * Runs a postprocessing loop over all elements, and if
    * \p postprocess_sides is true over all sides.
@@ -214,6 +246,69 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * If cache_element_jacobians is true (it is false by default), the
+   * unconstrained element jacobians computed during assembly are
+   * cached by element id, and subsequent assemblies reuse them
+   * instead of recomputing, skipping the jacobian integration -- and,
+   * where no residual is needed, the FE reinitialization -- entirely.
+   *
+   * This is only valid for linear problems whose jacobian does not
+   * change between assemblies: the mesh, the time step size, and any
+   * equation coefficients must stay fixed, or
+   * clear_element_jacobian_cache() must be called when they change.
+   * The cache is dropped automatically when the system gets
+   * reinitialized.
+   */
+  bool cache_element_jacobians;
+
+  /**
+   * If pipeline_assembly is true (it is false by default), assembly
+   * on a distributed mesh visits the elements coupled to
+   * off-processor degrees of freedom first, starts communicating
+   * their off-processor jacobian contributions, and assembles the
+   * purely local interior elements while those messages are in
+   * flight, via SparseMatrix::flush_begin()/flush_end().
+   *
+   * Elements with constrained degrees of freedom are conservatively
+   * treated as boundary-coupled, since constraint application can
+   * scatter their contributions to other processors' rows.
+   */
+  bool pipeline_assembly;
+
+  /**
+   * If colored_assembly is true (it is false by default), assembly
+   * processes the mesh one element color at a time, using
+   * MeshBase::element_colors().  No two elements within a color share
+   * a node, so when no local degrees of freedom are constrained and
+   * no SCALAR variables are present their matrix contributions cannot
+   * conflict, and the per-insertion assembly lock is skipped
+   * entirely.  When constraints or SCALAR variables could scatter
+   * contributions across color boundaries the lock is retained, but
+   * coloring still reduces contention on it.
+   *
+   * If pipeline_assembly is also set, it takes precedence.
+   */
+  bool colored_assembly;
+
+  /**
+   * \returns A pointer to the cached unconstrained element jacobian
+   * for element \p elem_id, or \p nullptr if none is cached.
+   */
+  const DenseMatrix<Number> * get_cached_element_jacobian (dof_id_type elem_id) const;
+
+  /**
+   * Caches \p jacobian as the unconstrained element jacobian for
+   * element \p elem_id.
+   */
+  void set_cached_element_jacobian (dof_id_type elem_id,
+                                    const DenseMatrix<Number> & jacobian);
+
+  /**
+   * Discards all cached element jacobians.
+   */
+  void clear_element_jacobian_cache ();
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
@@ -256,6 +351,25 @@ protected:
 
 private:
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * Contexts waiting to be reused by acquire_context(), guarded for
+   * concurrent access from threaded assembly workers.
+   */
+  std::vector<std::unique_ptr<DiffContext>> _context_pool;
+
+  Threads::spin_mutex _context_pool_mutex;
+
+  /**
+   * Cached unconstrained element jacobians by element id, guarded for
+   * concurrent access from threaded assembly workers.  Entries are
+   * never modified after insertion, so pointers handed out by
+   * get_cached_element_jacobian() stay valid while other threads
+   * insert.
+   */
+  std::unordered_map<dof_id_type, DenseMatrix<Number>> _elem_jacobian_cache;
+
+  mutable Threads::spin_mutex _elem_jacobian_cache_mutex;
 };
 
 // --------------------------------------------------------------
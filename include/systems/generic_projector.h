@@ -593,7 +593,7 @@ protected:
           }
         else
           {
-            if (!elem.old_dof_object)
+            if (!elem.get_old_dof_object())
               {
                 libmesh_error();
               }
@@ -643,7 +643,7 @@ protected:
           }
         else
           {
-            if (!elem.old_dof_object)
+            if (!elem.get_old_dof_object())
               return false;
 
             old_context.pre_fe_reinit(sys, &elem);
@@ -778,12 +778,12 @@ public:
 
     // Be sure to handle cases where the variable wasn't defined on
     // this node (e.g. due to changing subdomain support)
-    if (n.old_dof_object &&
-        n.old_dof_object->n_vars(this->sys.number()) &&
-        n.old_dof_object->n_comp(this->sys.number(), var))
+    if (n.get_old_dof_object() &&
+        n.get_old_dof_object()->n_vars(this->sys.number()) &&
+        n.get_old_dof_object()->n_comp(this->sys.number(), var))
       {
         const dof_id_type first_old_id =
-          n.old_dof_object->dof_number(this->sys.number(), var, dim);
+          n.get_old_dof_object()->dof_number(this->sys.number(), var, dim);
         std::vector<dof_id_type> old_ids(n_mixed);
         std::iota(old_ids.begin(), old_ids.end(), first_old_id);
         old_solution.get(old_ids, derivs);
@@ -870,7 +870,7 @@ public:
     // zero.
     if (nc != 0)
       {
-        const DofObject *old_dof_object = old_elem.old_dof_object;
+        const DofObject *old_dof_object = old_elem.get_old_dof_object();
         libmesh_assert(old_dof_object);
         libmesh_assert_greater(elem.n_systems(), sys_num);
 
@@ -1015,15 +1015,15 @@ eval_at_node(const FEMContext & c,
 
   const Elem::RefinementState flag = c.get_elem().refinement_flag();
 
-  if (n.old_dof_object &&
+  if (n.get_old_dof_object() &&
       (!extra_hanging_dofs ||
        flag == Elem::JUST_COARSENED ||
        flag == Elem::DO_NOTHING) &&
-      n.old_dof_object->n_vars(sys.number()) &&
-      n.old_dof_object->n_comp(sys.number(), var))
+      n.get_old_dof_object()->n_vars(sys.number()) &&
+      n.get_old_dof_object()->n_comp(sys.number(), var))
     {
       const dof_id_type old_id =
-        n.old_dof_object->dof_number(sys.number(), var, 0);
+        n.get_old_dof_object()->dof_number(sys.number(), var, 0);
       return old_solution(old_id);
     }
 
@@ -1065,19 +1065,19 @@ eval_at_node(const FEMContext & c,
 
   const Elem::RefinementState flag = elem.refinement_flag();
 
-  if (n.old_dof_object &&
+  if (n.get_old_dof_object() &&
       (!extra_hanging_dofs ||
        flag == Elem::JUST_COARSENED ||
        flag == Elem::DO_NOTHING) &&
-      n.old_dof_object->n_vars(sys.number()) &&
-      n.old_dof_object->n_comp(sys.number(), var))
+      n.get_old_dof_object()->n_vars(sys.number()) &&
+      n.get_old_dof_object()->n_comp(sys.number(), var))
     {
       Gradient return_val;
 
       for (unsigned int dim = 0; dim < elem.dim(); ++dim)
       {
         const dof_id_type old_id =
-          n.old_dof_object->dof_number(sys.number(), var, dim);
+          n.get_old_dof_object()->dof_number(sys.number(), var, dim);
         return_val(dim) = old_solution(old_id);
       }
 
@@ -1122,18 +1122,18 @@ eval_at_node(const FEMContext & c,
 
   const Elem::RefinementState flag = c.get_elem().refinement_flag();
 
-  if (n.old_dof_object &&
+  if (n.get_old_dof_object() &&
       (!extra_hanging_dofs ||
        flag == Elem::JUST_COARSENED ||
        flag == Elem::DO_NOTHING) &&
-      n.old_dof_object->n_vars(sys.number()) &&
-      n.old_dof_object->n_comp(sys.number(), var))
+      n.get_old_dof_object()->n_vars(sys.number()) &&
+      n.get_old_dof_object()->n_comp(sys.number(), var))
     {
       Gradient g;
       for (unsigned int d = 0; d != elem_dim; ++d)
         {
           const dof_id_type old_id =
-            n.old_dof_object->dof_number(sys.number(), var, d+1);
+            n.get_old_dof_object()->dof_number(sys.number(), var, d+1);
           g(d) = old_solution(old_id);
         }
       return g;
@@ -1505,7 +1505,7 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SortAndCopy
           // wasn't just refined or just coarsened into activity, then
           // it must be newly added, so the user is responsible for
           // setting the new dofs on it during a grid projection.
-          if (!elem->old_dof_object &&
+          if (!elem->get_old_dof_object() &&
               elem->refinement_flag() != Elem::JUST_REFINED &&
               elem->refinement_flag() != Elem::JUST_COARSENED)
             continue;
@@ -2305,6 +2305,11 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectEdge
       context.edge = edge_num;
       context.pre_fe_reinit(system, &elem);
 
+      // The FE objects in context are keyed on FEType, so a single
+      // edge_fe_reinit() call covers every variable sharing an FEType;
+      // we only need to do it once per edge, not once per variable.
+      bool fe_objects_reinitted = false;
+
       this->find_dofs_to_send(edge_node, elem, node_num, edge_vars);
 
       // Look at all the variables we're supposed to interpolate from
@@ -2422,7 +2427,11 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectEdge
             }
           else
 #endif // LIBMESH_ENABLE_AMR
-            context.edge_fe_reinit();
+            if (!fe_objects_reinitted)
+              {
+                context.edge_fe_reinit();
+                fe_objects_reinitted = true;
+              }
 
           const std::vector<dof_id_type> & dof_indices =
             context.get_dof_indices(var);
@@ -2486,6 +2495,11 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectSide
       context.side = side_num;
       context.pre_fe_reinit(system, &elem);
 
+      // The FE objects in context are keyed on FEType, so a single
+      // side_fe_reinit() call covers every variable sharing an FEType;
+      // we only need to do it once per side, not once per variable.
+      bool fe_objects_reinitted = false;
+
       this->find_dofs_to_send(side_node, elem, node_num, side_vars);
 
       // Look at all the variables we're supposed to interpolate from
@@ -2603,7 +2617,11 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectSide
             }
           else
 #endif // LIBMESH_ENABLE_AMR
-            context.side_fe_reinit();
+            if (!fe_objects_reinitted)
+              {
+                context.side_fe_reinit();
+                fe_objects_reinitted = true;
+              }
 
           const std::vector<dof_id_type> & dof_indices =
             context.get_dof_indices(var);
@@ -2636,6 +2654,11 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectInte
 
       context.pre_fe_reinit(system, elem);
 
+      // The FE objects in context are keyed on FEType, so a single
+      // elem_fe_reinit() call covers every variable sharing an FEType;
+      // we only need to do it once per element, not once per variable.
+      bool fe_objects_reinitted = false;
+
       // Loop over all the variables we've been requested to project, to
       // do the projection
       for (const auto & var : this->projector.variables)
@@ -2742,7 +2765,11 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectInte
             }
           else
 #endif // LIBMESH_ENABLE_AMR
-            context.elem_fe_reinit();
+            if (!fe_objects_reinitted)
+              {
+                context.elem_fe_reinit();
+                fe_objects_reinitted = true;
+              }
 
           const std::vector<dof_id_type> & dof_indices =
             context.get_dof_indices(var);
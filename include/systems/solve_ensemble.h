@@ -0,0 +1,152 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SOLVE_ENSEMBLE_H
+#define LIBMESH_SOLVE_ENSEMBLE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class schedules many small independent forward solves across
+ * subcommunicators of a single large allocation, so e.g. one
+ * 4096-rank job can run 512 concurrent 8-rank solves without external
+ * orchestration.  The global communicator is split into \p n_groups
+ * contiguous groups; parameter points are distributed round-robin
+ * across the groups, each group builds its own Mesh and
+ * EquationSystems on its group communicator, and the resulting
+ * quantities of interest are summed back onto every rank.
+ *
+ * \author Benjamin S. Kirk
+ * \date 2020
+ * \brief Runs independent solves concurrently on split subcommunicators.
+ */
+class SolveEnsemble : public ParallelObject
+{
+public:
+
+  /**
+   * Abstract base class for the per-point computation.  The \p solve()
+   * method is called collectively on every rank of \p group_comm, once
+   * for each parameter point assigned to that group, and must fill \p
+   * qoi (pre-sized and zeroed) with values consistent across the
+   * group's ranks.
+   */
+  class SolveFunction
+  {
+  public:
+    virtual ~SolveFunction () = default;
+
+    virtual void solve (const Parallel::Communicator & group_comm,
+                        std::size_t point_index,
+                        std::vector<Number> & qoi) = 0;
+  };
+
+  /**
+   * Constructor.  Splits \p comm_in into \p n_groups groups of
+   * near-equal size; must be called collectively, with \p n_groups no
+   * larger than the number of ranks.
+   */
+  SolveEnsemble (const Parallel::Communicator & comm_in,
+                 unsigned int n_groups);
+
+  /**
+   * Destructor.
+   */
+  virtual ~SolveEnsemble ();
+
+  /**
+   * \returns The number of subcommunicator groups.
+   */
+  unsigned int n_groups () const { return _n_groups; }
+
+  /**
+   * \returns The group this rank belongs to.
+   */
+  unsigned int group_id () const { return _group_id; }
+
+  /**
+   * \returns The communicator shared by this rank's group, suitable
+   * for constructing a Mesh and EquationSystems.
+   */
+  const Parallel::Communicator & group_comm () const { return _group_comm; }
+
+  /**
+   * Runs \p f.solve() for \p n_points parameter points, each
+   * producing \p n_qoi quantities of interest, distributing the
+   * points round-robin across the groups.  Collective on the global
+   * communicator; on return every rank holds all results.
+   */
+  void run (std::size_t n_points,
+            unsigned int n_qoi,
+            SolveFunction & f);
+
+  /**
+   * \returns The aggregated results from the last \p run() call,
+   * stored point-major: entry [point*n_qoi + q] is qoi \p q at \p
+   * point.
+   */
+  const std::vector<Number> & qoi_results () const { return _qoi_results; }
+
+  /**
+   * \returns A single aggregated qoi value from the last \p run() call.
+   */
+  Number qoi (std::size_t point_index, unsigned int q) const;
+
+protected:
+
+  /**
+   * The number of groups the global communicator was split into.
+   */
+  const unsigned int _n_groups;
+
+  /**
+   * The group this rank belongs to.
+   */
+  unsigned int _group_id;
+
+  /**
+   * The subcommunicator shared by this rank's group.
+   */
+  Parallel::Communicator _group_comm;
+
+  /**
+   * Number of qoi values per point in the last run.
+   */
+  unsigned int _n_qoi;
+
+  /**
+   * Aggregated qoi values, stored point-major.
+   */
+  std::vector<Number> _qoi_results;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_SOLVE_ENSEMBLE_H
@@ -43,9 +43,16 @@ enum FEMNormType : int;
 #include "libmesh/enum_norm_type.h"
 #endif
 
+namespace libMesh
+{
+enum XdrMODE : int;
+}
+
 // C++ includes
 #include <cstddef>
 #include <set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -67,6 +74,7 @@ class EquationSystems;
 class MeshBase;
 class Xdr;
 class DofMap;
+class Elem;
 template <typename Output> class FunctionBase;
 class Parameters;
 class ParameterVector;
@@ -319,6 +327,28 @@ public:
                                         bool include_liftfunc = true,
                                         bool apply_constraints = true);
 
+  /**
+   * Snapshots the current local solution into a recycled buffer and
+   * records \p qoi_indices, deferring the quantity of interest mesh
+   * sweep until deferred_qoi_values() is called.  This keeps passive
+   * monitoring functionals out of the timestep loop: the snapshot is
+   * one vector copy, and the solve for the next step may overwrite
+   * the solution before the functionals of this one are evaluated.
+   */
+  void defer_qoi_evaluation (const QoISet & qoi_indices = QoISet());
+
+  /**
+   * \returns \p true if a deferred qoi evaluation is pending.
+   */
+  bool qoi_evaluation_deferred () const { return _qoi_evaluation_deferred; }
+
+  /**
+   * Performs any qoi evaluation scheduled by defer_qoi_evaluation(),
+   * against the snapshotted solution, then returns the \p qoi values.
+   * This is collective, and leaves the current solution untouched.
+   */
+  const std::vector<Number> & deferred_qoi_values ();
+
   /**
    * Calls residual parameter derivative function.
    *
@@ -801,6 +831,43 @@ public:
                                       const bool projections=true,
                                       const ParallelType type = PARALLEL);
 
+  /**
+   * Adds the additional vector \p vec_name to this system as a
+   * copy-on-write reference to the identically named vector of \p
+   * source_system, which must distribute its dofs the same way (e.g.
+   * a system holding the same variables on the same mesh).  Read
+   * access through the \p const \p get_vector() overloads goes
+   * straight to the source system's storage, so coefficient fields
+   * duplicated across coupled systems are stored - and localized -
+   * only once.  The first writable \p get_vector(vec_name) access
+   * detaches a private copy of the current values.
+   *
+   * The source system must outlive any use of the shared vector.
+   */
+  const NumericVector<Number> & add_vector (const std::string & vec_name,
+                                            System & source_system);
+
+  /**
+   * \returns \p true if the vector \p vec_name is currently a
+   * copy-on-write reference to another system's storage.
+   */
+  bool vector_is_shared (const std::string & vec_name) const;
+
+  /**
+   * Replaces the copy-on-write reference \p vec_name with a private
+   * copy of the source system's current values.  Called automatically
+   * by the first writable \p get_vector(vec_name) access.
+   */
+  NumericVector<Number> & detach_shared_vector (const std::string & vec_name);
+
+  /**
+   * \returns A serial localization of the vector \p vec_name.  The
+   * localization is built once on the system owning the storage and
+   * reused by every sharing reader until the owner next fetches the
+   * vector for writing.
+   */
+  const NumericVector<Number> & localize_shared_vector (const std::string & vec_name);
+
   /**
    * Removes the additional vector \p vec_name from this system
    */
@@ -918,6 +985,62 @@ public:
    */
   bool vector_preservation (const std::string & vec_name) const;
 
+  /**
+   * Writes the locally owned values of the vector identified by \p
+   * vec_name to a per-processor scratch file in \p scratch_directory
+   * and frees the vector's in-core storage.  The vector must not be
+   * accessed until it has been reloaded; \p update() reloads all
+   * spilled vectors automatically, so spilling is safe for history
+   * vectors which are only read at the start of a step.  Spilled
+   * vectors must be reloaded before the mesh or dof distribution
+   * changes.
+   */
+  void spill_vector (const std::string & vec_name,
+                     const std::string & scratch_directory);
+
+  /**
+   * Restores a vector previously written out by \p spill_vector(),
+   * removing its scratch file.  A no-op if the vector is not
+   * currently spilled.
+   */
+  void reload_vector (const std::string & vec_name);
+
+  /**
+   * Restores every vector currently spilled by \p spill_vector().
+   */
+  void reload_spilled_vectors ();
+
+  /**
+   * \returns \p true if the vector identified by \p vec_name is
+   * currently spilled to disk.
+   */
+  bool vector_is_spilled (const std::string & vec_name) const;
+
+  /**
+   * Marks the additional vector \p vec_name for lazy allocation: any
+   * storage it currently holds is freed, and global storage (with
+   * ghost maps, for GHOSTED vectors) is materialized - zeroed - on the
+   * vector's first access instead.  Useful for solver scratch vectors
+   * which go untouched in many configurations.  A deferred vector
+   * must not be shared or spilled, and is skipped by projection on
+   * mesh changes until it materializes.
+   */
+  void defer_vector_allocation (const std::string & vec_name);
+
+  /**
+   * Materializes the deferred vector \p vec_name immediately - a
+   * preallocation hint for vectors known to be hot, keeping the
+   * allocation out of the first timed access.  A no-op if the vector
+   * is not currently deferred.
+   */
+  void preallocate_vector (const std::string & vec_name);
+
+  /**
+   * \returns \p true if the vector identified by \p vec_name is
+   * awaiting lazy allocation.
+   */
+  bool vector_allocation_deferred (const std::string & vec_name) const;
+
   /**
    * \returns A reference to one of the system's adjoint solution
    * vectors, by default the one corresponding to the first qoi.
@@ -1247,6 +1370,22 @@ public:
                       const SystemNorm & norm,
                       std::set<unsigned int> * skip_dimensions=nullptr) const;
 
+  /**
+   * \returns The norms of the vector \p v requested by each (variable,
+   * norm type) pair in \p norm_requests, in the same order.
+   *
+   * This computes the same values as one \p calculate_norm() call per
+   * pair, but performs all requested integrations in a single sweep
+   * over the mesh, with one \p FE reinit per element for each distinct
+   * finite element type and a single parallel reduction per reduction
+   * operation, so it is much cheaper when several norms are monitored
+   * at once.
+   */
+  std::vector<Real>
+  calculate_norms(const NumericVector<Number> & v,
+                  const std::vector<std::pair<unsigned int, FEMNormType>> & norm_requests,
+                  std::set<unsigned int> * skip_dimensions=nullptr) const;
+
   /**
    * Reads the basic data header for this System.
    */
@@ -1305,6 +1444,25 @@ public:
                                        const std::vector<NumericVector<Number> *> & vectors) const
   { return read_serialized_vectors<Number>(io, vectors); }
 
+  /**
+   * Read a number of identically distributed vectors from the striped
+   * file set written by \p write_striped_vectors().  The directory
+   * file \p name is read on processor 0; each stripe is then read by
+   * the processor which wrote it, concurrently with the others, and
+   * its slices scattered to the owning processors.  \p mode must be a
+   * reading mode (\p READ or \p DECODE) matching how the set was
+   * written.
+   *
+   * Unlike the serialized formats, the values are stored by raw dof
+   * index, so the same dof numbering (though not the same
+   * partitioning) is required on restart.
+   *
+   * \returns The global number of values read.
+   */
+  std::size_t read_striped_vectors (const std::string & name,
+                                    const XdrMODE mode,
+                                    const std::vector<NumericVector<Number> *> & vectors) const;
+
   /**
    * Reads additional data, namely vectors, for this System.
    * This method may safely be called on a distributed-memory mesh.
@@ -1349,6 +1507,22 @@ public:
   std::size_t write_serialized_vectors (Xdr & io,
                                         const std::vector<const NumericVector<Number> *> & vectors) const;
 
+  /**
+   * Write a number of identically distributed vectors as a striped
+   * file set: a small directory file \p name written from processor
+   * 0, plus one independent stripe file per vector, written
+   * concurrently by the processors the vectors are dealt out to
+   * round-robin.  With a ".gz" \p name each stripe is its own
+   * independently compressed stream, so many-vector dumps (e.g.
+   * SolutionHistory) are no longer bottlenecked on one serial
+   * stream.  \p mode must be a writing mode (\p WRITE or \p ENCODE).
+   *
+   * \returns The global number of values written.
+   */
+  std::size_t write_striped_vectors (const std::string & name,
+                                     const XdrMODE mode,
+                                     const std::vector<const NumericVector<Number> *> & vectors) const;
+
   /**
    * Writes additional data, namely vectors, for this System.
    * This method may safely be called on a distributed-memory mesh.
@@ -1561,6 +1735,58 @@ public:
    */
   std::unique_ptr<NumericVector<Number>> current_local_solution;
 
+  /**
+   * Configures a rolling buffer holding elemental solution snapshots
+   * for the last \p n_snapshots recorded steps: one contiguous block
+   * of dof values per active local element, in the ordering of \p
+   * DofMap::dof_indices(elem).  This trades keeping (and
+   * re-localizing) whole ghosted vectors per history step for a
+   * compact cache of only the element-local values, which is what
+   * time-derivative stencils at quadrature points actually consume.
+   *
+   * Passing zero discards the buffer.  The buffer is laid out for the
+   * current dof distribution; it is reallocated (empty) by reinit()
+   * after a mesh change.
+   */
+  void init_elem_snapshots (unsigned int n_snapshots);
+
+  /**
+   * \returns The number of snapshot slots configured by
+   * init_elem_snapshots(), zero if no buffer exists.
+   */
+  unsigned int n_elem_snapshots () const { return _n_elem_snapshots; }
+
+  /**
+   * \returns How many snapshots have actually been recorded, up to
+   * n_elem_snapshots().
+   */
+  unsigned int n_elem_snapshots_stored () const
+  { return _n_elem_snapshots_stored; }
+
+  /**
+   * Records the element-local values of \p current_local_solution
+   * into the snapshot buffer, overwriting the oldest snapshot once
+   * the buffer is full.  Call update() first if \p solution has
+   * changed.  Typically called once per accepted timestep.
+   */
+  void push_elem_snapshot ();
+
+  /**
+   * \returns A pointer to the recorded dof values of \p elem from \p
+   * steps_back pushes ago (0 is the most recent), ordered like \p
+   * DofMap::dof_indices(elem); e.g. from an assembly loop,
+   * \p elem_snapshot(context.get_elem(), 1).  \p steps_back must be
+   * less than n_elem_snapshots_stored() and \p elem must be an active
+   * local element.
+   */
+  const Number * elem_snapshot (const Elem & elem,
+                                unsigned int steps_back) const;
+
+  /**
+   * Discards the snapshot buffer and its configuration.
+   */
+  void clear_elem_snapshots ();
+
   /**
    * For time-dependent problems, this is the time t at the beginning of
    * the current timestep.
@@ -1735,6 +1961,34 @@ public:
     project_with_constraints = _project_with_constraints;
   }
 
+  /**
+   * Setter and getter functions for the cache_projection_matrix
+   * boolean.  When \p true, \p project_vector() assembles the
+   * old-to-new projection operator into a \p SparseMatrix the first
+   * time it is needed and applies it as a matvec on subsequent
+   * projections between the same pair of dof distributions, e.g. when
+   * projecting many vectors after a single mesh change or repeating
+   * the same inter-mesh transfer.  Requires configuring with
+   * MetaPhysicL support; without it the flag is ignored.
+   */
+  bool get_cache_projection_matrix()
+  {
+    return cache_projection_matrix;
+  }
+
+  void set_cache_projection_matrix(bool _cache_projection_matrix)
+  {
+    cache_projection_matrix = _cache_projection_matrix;
+  }
+
+  /**
+   * Drops any cached projection operator.  This is done automatically
+   * whenever the dof distribution changes via \p restrict_vectors();
+   * users changing the source dof distribution by other means should
+   * call this themselves.
+   */
+  void clear_projection_matrix_cache();
+
   /**
    * \returns A writable reference to a boolean that determines if this system
    * can be written to file or not.  If set to \p true, then
@@ -1906,6 +2160,13 @@ private:
   void late_matrix_init(SparseMatrix<Number> & mat,
                         ParallelType type);
 
+  /**
+   * Allocates and zeros the vector \p vec_name now if its allocation
+   * was deferred; a no-op otherwise.  Called from every vector
+   * accessor, and \p const so that read access can materialize too.
+   */
+  void materialize_deferred_vector (const std::string & vec_name) const;
+
   /**
    * Finds the discrete norm for the entries in the vector
    * corresponding to Dofs associated with var.
@@ -2133,6 +2394,72 @@ private:
    */
   std::map<std::string, ParallelType> _vector_types;
 
+  /**
+   * Maps the name of each vector currently spilled to disk by \p
+   * spill_vector() to its scratch file.
+   */
+  std::map<std::string, std::string> _spilled_vectors;
+
+  /**
+   * Names of vectors marked by \p defer_vector_allocation() whose
+   * storage has not yet materialized.  Mutable so that \p const
+   * accessors can materialize on a first read.
+   */
+  mutable std::set<std::string> _deferred_vectors;
+
+  /**
+   * Copy-on-write vectors shared from another system, mapped to the
+   * system owning the underlying storage.
+   */
+  std::map<std::string, System *> _shared_vectors;
+
+  /**
+   * Cached serial localizations built by \p localize_shared_vector(),
+   * keyed by vector name.  An entry is dropped whenever its vector is
+   * fetched for writing.
+   */
+  std::map<std::string, std::unique_ptr<NumericVector<Number>>> _shared_localizations;
+
+  /**
+   * The recycled solution snapshot buffer used by \p
+   * defer_qoi_evaluation(), with the requested indices and whether an
+   * evaluation is still pending.
+   */
+  std::unique_ptr<NumericVector<Number>> _deferred_qoi_solution;
+
+  QoISet _deferred_qoi_set;
+
+  bool _qoi_evaluation_deferred;
+
+  /**
+   * Number of slots in the elemental solution snapshot buffer, zero
+   * if no buffer has been configured.
+   */
+  unsigned int _n_elem_snapshots;
+
+  /**
+   * Number of snapshots recorded so far, up to _n_elem_snapshots.
+   */
+  unsigned int _n_elem_snapshots_stored;
+
+  /**
+   * The ring slot the most recent snapshot was recorded into.
+   */
+  unsigned int _elem_snapshot_head;
+
+  /**
+   * The snapshot buffer: per active local element, a contiguous block
+   * of _n_elem_snapshots copies of its dof values.
+   */
+  std::vector<Number> _elem_snapshots;
+
+  /**
+   * Maps element ids to (block offset, dofs per snapshot) within
+   * _elem_snapshots.
+   */
+  std::unordered_map<dof_id_type, std::pair<std::size_t, unsigned int>>
+    _elem_snapshot_offsets;
+
   /**
    * Some systems need an arbitrary number of matrices.
    */
@@ -2209,6 +2536,20 @@ private:
    * Do we want to apply constraints while projecting vectors ?
    */
   bool project_with_constraints;
+
+  /**
+   * Do we want to reuse an assembled projection operator across
+   * \p project_vector() calls ?
+   */
+  bool cache_projection_matrix;
+
+  /**
+   * The cached projection operator, assembled lazily by
+   * \p project_vector() when \p cache_projection_matrix is set.
+   * Mutable since projecting a vector is a \p const operation on the
+   * System.
+   */
+  mutable std::unique_ptr<SparseMatrix<Number>> _projection_matrix_cache;
 };
 
 
@@ -2426,7 +2767,7 @@ dof_id_type System::n_active_dofs() const
 inline
 bool System::have_vector (const std::string & vec_name) const
 {
-  return (_vectors.count(vec_name));
+  return (_vectors.count(vec_name) || _shared_vectors.count(vec_name));
 }
 
 
@@ -0,0 +1,98 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ALIGNED_ALLOCATOR_H
+#define LIBMESH_ALIGNED_ALLOCATOR_H
+
+// C++ includes
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new> // std::bad_alloc
+
+namespace libMesh
+{
+
+/**
+ * An STL-compatible allocator whose allocations are aligned to \p
+ * Alignment bytes, independent of what the system allocator
+ * guarantees.  The default of 64 bytes suits both cache lines and
+ * the widest common SIMD registers, so containers using this
+ * allocator can feed aligned vector loads and stores directly.
+ *
+ * \author Roy H. Stogner
+ * \date 2026
+ * \brief STL allocator returning buffers of guaranteed alignment.
+ */
+template <typename T, std::size_t Alignment = 64>
+class AlignedAllocator
+{
+  static_assert((Alignment & (Alignment-1)) == 0,
+                "Alignment must be a power of two");
+  static_assert(Alignment >= sizeof(void *),
+                "Alignment must leave room to stash a pointer");
+
+public:
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+  AlignedAllocator() = default;
+
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment> &) {}
+
+  T * allocate (std::size_t n)
+  {
+    // Over-allocate so that we can both align the user block and
+    // stash the raw pointer just below it for deallocate()
+    void * raw = std::malloc(n*sizeof(T) + Alignment + sizeof(void *));
+    if (!raw)
+      throw std::bad_alloc();
+
+    const std::uintptr_t aligned =
+      (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *) + Alignment - 1)
+      & ~std::uintptr_t(Alignment - 1);
+
+    reinterpret_cast<void **>(aligned)[-1] = raw;
+
+    return reinterpret_cast<T *>(aligned);
+  }
+
+  void deallocate (T * p, std::size_t)
+  {
+    if (p)
+      std::free(reinterpret_cast<void **>(p)[-1]);
+  }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+inline bool operator== (const AlignedAllocator<T, Alignment> &,
+                        const AlignedAllocator<U, Alignment> &)
+{ return true; }
+
+template <typename T, typename U, std::size_t Alignment>
+inline bool operator!= (const AlignedAllocator<T, Alignment> &,
+                        const AlignedAllocator<U, Alignment> &)
+{ return false; }
+
+} // namespace libMesh
+
+#endif // LIBMESH_ALIGNED_ALLOCATOR_H
@@ -102,6 +102,15 @@ public:
    */
   virtual Real median() const override;
 
+  /**
+   * \returns An estimate of the quantile \p fraction of the data set,
+   * ignoring inactive elements, computed in a single pass with a
+   * P2QuantileEstimator.
+   *
+   * Unlike median(), this neither sorts nor copies the data.
+   */
+  virtual Real p2_quantile(const Real fraction = 0.5) const override;
+
   /**
    * \returns The variance of the data set ignoring inactive elements.
    *
@@ -128,6 +137,16 @@ public:
    */
   virtual Real variance(const Real mean) const override;
 
+  /**
+   * Computes the mean and variance of the data set together, in a
+   * single pass over the data, ignoring inactive elements.
+   *
+   * The results are identical to calling mean() and then variance(),
+   * but the data is only read once instead of three times.
+   */
+  virtual void mean_and_variance(Real & the_mean,
+                                 Real & the_variance) const override;
+
   /**
    * \returns A vector of dof_id_types which correspond
    * to the indices of every member of the data set
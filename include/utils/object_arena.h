@@ -0,0 +1,161 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+#ifndef LIBMESH_OBJECT_ARENA_H
+#define LIBMESH_OBJECT_ARENA_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A size-segregated arena for the many small objects (\p Node, \p
+ * Elem subclasses) a mesh allocates during construction.  Memory is
+ * carved out of large chunks, so consecutive allocations of the same
+ * object type are nearly contiguous and the per-object malloc
+ * overhead disappears; freed objects go onto a per-size free list for
+ * reuse.  Chunks are only returned to the system by \p purge(), once
+ * every object allocated from the arena has been deleted.
+ *
+ * The arena is opt-in and process-global: bulk construction paths
+ * (mesh generation, mesh file readers) enable it over their own scope
+ * via \p ScopedEnable, and \p Elem and \p Node route their \p
+ * operator \p new / \p delete through \p acquire() / \p release().
+ * Objects allocated while the arena is disabled come from the global
+ * heap, and \p release() hands anything the arena does not own back
+ * to the heap, so enabling and disabling at any time is safe.
+ *
+ * \author John W. Peterson
+ * \date 2020
+ * \brief Chunked, size-segregated allocation arena for mesh objects.
+ */
+class ObjectArena
+{
+public:
+
+  /**
+   * \returns The global arena.
+   */
+  static ObjectArena & instance ();
+
+  /**
+   * Enables/disables arena allocation for subsequent \p acquire()
+   * calls.  Calls may nest; the arena is active while at least one
+   * enable is outstanding.
+   */
+  static void enable ();
+  static void disable ();
+
+  /**
+   * \returns \p true if \p acquire() is currently serving from the
+   * arena.
+   */
+  static bool enabled ();
+
+  /**
+   * RAII helper enabling the arena over a scope, e.g. the body of a
+   * mesh reader.
+   */
+  struct ScopedEnable
+  {
+    ScopedEnable () { ObjectArena::enable(); }
+    ~ScopedEnable () { ObjectArena::disable(); }
+
+    ScopedEnable (const ScopedEnable &) = delete;
+    ScopedEnable & operator= (const ScopedEnable &) = delete;
+  };
+
+  /**
+   * \returns \p size bytes, from the arena when it is enabled and
+   * from the global heap otherwise.
+   */
+  void * acquire (std::size_t size);
+
+  /**
+   * Returns \p ptr to the free list it was acquired from, or to the
+   * global heap if the arena does not own it.
+   */
+  void release (void * ptr, std::size_t size);
+
+  /**
+   * \returns \p true if \p ptr points into one of our chunks.
+   */
+  bool owns (const void * ptr) const;
+
+  /**
+   * Releases all chunks back to the system.  Only permitted once all
+   * arena-allocated objects have been deleted.
+   */
+  void purge ();
+
+  /**
+   * \returns The number of arena allocations not yet released.
+   */
+  std::size_t n_outstanding () const { return _n_outstanding; }
+
+  /**
+   * \returns The total bytes currently held in chunks.
+   */
+  std::size_t bytes_allocated () const;
+
+private:
+
+  ObjectArena () = default;
+  ~ObjectArena ();
+
+  ObjectArena (const ObjectArena &) = delete;
+  ObjectArena & operator= (const ObjectArena &) = delete;
+
+  /**
+   * Bytes served per chunk.  1 MB holds e.g. ~4000 Hex8 objects, big
+   * enough to amortize the underlying malloc, small enough not to
+   * strand much memory on tiny meshes.
+   */
+  static const std::size_t chunk_size = 1048576;
+
+  /**
+   * The chunks proper, each paired with its size, kept sorted by
+   * address so \p owns() is a binary search.
+   */
+  std::vector<std::pair<char *, std::size_t>> _chunks;
+
+  /**
+   * Head of the free list for each rounded allocation size; freed
+   * slots store the next-pointer in-place.
+   */
+  std::map<std::size_t, void *> _free_lists;
+
+  /**
+   * Bump pointer and bytes remaining in the chunk currently being
+   * carved, per rounded allocation size.  Segregating the bump
+   * regions by size keeps same-type objects adjacent.
+   */
+  std::map<std::size_t, std::pair<char *, std::size_t>> _bump;
+
+  std::size_t _n_outstanding = 0;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_OBJECT_ARENA_H
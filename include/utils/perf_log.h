@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <stack>
 #include <string>
@@ -110,6 +111,68 @@ protected:
 
 
 
+/**
+ * The \p FastPerfData struct contains the accumulators used by the
+ * low-overhead "fast event" interface of \p PerfLog.  Timestamps are
+ * raw CPU cycle counts where a cycle counter is available, and are
+ * only converted to seconds when a report is generated.
+ *
+ * \author Benjamin Kirk
+ * \date 2020
+ * \brief Data object managed by the PerfLog fast event interface
+ */
+struct FastPerfData
+{
+  /**
+   * Constructor.  The character arrays must outlive the PerfLog, just
+   * as for \p PerfLog::fast_push().
+   */
+  FastPerfData (const char * label_in,
+                const char * header_in) :
+    label(label_in),
+    header(header_in),
+    tot_cycles(0),
+    tstart_cycles(0),
+    count(0),
+    sampled_count(0),
+    sampling(false)
+  {}
+
+  /**
+   * The event label and header, as for the start/stop interface.
+   */
+  const char * label;
+  const char * header;
+
+  /**
+   * Total raw timestamp units accumulated over the sampled calls.
+   */
+  uint64_t tot_cycles;
+
+  /**
+   * Raw timestamp taken when the current sampled call started.
+   */
+  uint64_t tstart_cycles;
+
+  /**
+   * The number of times this event has been executed, whether or not
+   * each execution was timed.
+   */
+  std::size_t count;
+
+  /**
+   * The number of executions which were actually timed.
+   */
+  std::size_t sampled_count;
+
+  /**
+   * Flag indicating that the currently executing call is being timed.
+   */
+  bool sampling;
+};
+
+
+
 
 /**
  * The \p PerfLog class allows monitoring of specific events.
@@ -226,6 +289,58 @@ public:
   void pop (const std::string & label,
             const std::string & header="");
 
+  /**
+   * Registers an event for the low-overhead interface and \returns
+   * the integer id to pass to \p fast_start() and \p fast_stop().
+   *
+   * Unlike the push/pop interface, fast events carry no map lookup,
+   * no string handling and no pause/restart bookkeeping per call;
+   * their cost is an array index and a cycle counter read.  They do
+   * not participate in the event stack, so their times are reported
+   * without subtracting sub-events.  As with \p fast_push(), supply
+   * pointers to character arrays whose lifetime exceeds that of the
+   * PerfLog object.
+   */
+  unsigned int register_event (const char * label,
+                               const char * header="");
+
+  /**
+   * Starts timing the pre-registered fast event \p event_id.  Calls
+   * may not be nested for the same id.
+   */
+  void fast_start (const unsigned int event_id);
+
+  /**
+   * Stops timing the pre-registered fast event \p event_id.
+   */
+  void fast_stop (const unsigned int event_id);
+
+  /**
+   * Only time one of every \p interval executions of each fast
+   * event, statistically extrapolating the total time from the
+   * sampled calls at reporting time.  The call count remains exact.
+   * The default interval of 1 times every execution.
+   */
+  void set_sampling_interval (unsigned int interval)
+  { libmesh_assert(interval); sampling_interval = interval; }
+
+  /**
+   * Folds the accumulated fast event data into the main log, so that
+   * \p get_log() and friends report fast events alongside ordinary
+   * ones, and resets the fast event accumulators.  This is called
+   * automatically when a report is generated; event registrations
+   * survive it.
+   */
+  void sum_fast_events ();
+
+  /**
+   * \returns A raw timestamp for the fast event interface: the CPU
+   * cycle counter where one is available, otherwise microseconds from
+   * \p gettimeofday().  Conversion to seconds is done at reporting
+   * time, using a rate calibrated against the wall clock.
+   */
+  static uint64_t fast_timestamp ();
+
   /**
    * Start monitoring the event named \p label.
    */
@@ -287,6 +402,29 @@ public:
    */
   PerfData get_perf_data(const std::string & label, const std::string & header="");
 
+  /**
+   * Records a memory usage sample of \p bytes under \p label.  Only
+   * the high-water mark over all the samples with the same label is
+   * kept, and is reported alongside the timing tables by \p
+   * print_log().  Callers sample at phase boundaries (after mesh
+   * preparation, sparsity construction, solves, ...) so that OOM
+   * postmortems can say which subsystem owned the memory.
+   */
+  void log_memory_sample (const std::string & label,
+                          const std::size_t bytes);
+
+  /**
+   * \returns The largest memory sample recorded under \p label, in
+   * bytes, or zero if none has been recorded.
+   */
+  std::size_t get_memory_high_water (const std::string & label) const;
+
+  /**
+   * \returns A string displaying the recorded memory high-water
+   * marks, or an empty string if there are none.
+   */
+  std::string get_memory_info() const;
+
   /**
    * Typdef for the underlying logging data structure.
    */
@@ -331,6 +469,30 @@ private:
    */
   std::stack<PerfData*> log_stack;
 
+  /**
+   * The fast events, indexed by the ids handed out by
+   * register_event().
+   */
+  std::vector<FastPerfData> fast_events;
+
+  /**
+   * High-water marks of the memory samples, in bytes, keyed on
+   * sample label.
+   */
+  std::map<std::string, std::size_t> memory_log;
+
+  /**
+   * Time one of every \p sampling_interval fast event executions.
+   */
+  unsigned int sampling_interval;
+
+  /**
+   * The fast_timestamp() reading taken when we were constructed or
+   * last cleared, used together with \p tstart to calibrate raw
+   * timestamp units against the wall clock at reporting time.
+   */
+  uint64_t fast_tstart;
+
   /**
    * Flag indicating if print_log() has been called.
    * This is used to print a header with machine-specific
@@ -500,6 +662,65 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
 
 
 
+inline
+uint64_t PerfLog::fast_timestamp ()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  uint32_t lo, hi;
+  __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+  return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+  // No cycle counter available; fall back on microseconds.  The
+  // calibration in sum_fast_events() makes the units transparent to
+  // users either way.
+  struct timeval tnow;
+  gettimeofday (&tnow, nullptr);
+  return static_cast<uint64_t>(tnow.tv_sec)*1000000 +
+    static_cast<uint64_t>(tnow.tv_usec);
+#endif
+}
+
+
+
+inline
+void PerfLog::fast_start (const unsigned int event_id)
+{
+  if (this->log_events)
+    {
+      libmesh_assert_less (event_id, fast_events.size());
+      FastPerfData & perf_data = fast_events[event_id];
+
+      perf_data.count++;
+      if (perf_data.count % sampling_interval == 0)
+        {
+          perf_data.sampling = true;
+          perf_data.sampled_count++;
+          perf_data.tstart_cycles = fast_timestamp();
+        }
+    }
+}
+
+
+
+inline
+void PerfLog::fast_stop (const unsigned int event_id)
+{
+  if (this->log_events)
+    {
+      libmesh_assert_less (event_id, fast_events.size());
+      FastPerfData & perf_data = fast_events[event_id];
+
+      if (perf_data.sampling)
+        {
+          perf_data.tot_cycles +=
+            fast_timestamp() - perf_data.tstart_cycles;
+          perf_data.sampling = false;
+        }
+    }
+}
+
+
+
 inline
 double PerfLog::get_elapsed_time () const
 {
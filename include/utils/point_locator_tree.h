@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -100,13 +101,27 @@ public:
   /**
    * Locates the element in which the point with global coordinates
    * \p p is located, optionally restricted to a set of allowed subdomains.
-   * The mutable _element member is used to cache
-   * the result and allow it to be used during the next call to
-   * operator().
+   * The last element found is cached in a per-thread slot and tried
+   * first during the next call to operator(), so concurrent queries
+   * through a shared locator are safe and each thread benefits from
+   * its own locality.
    */
   virtual const Elem * operator() (const Point & p,
                                    const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
 
+  /**
+   * Locates the elements containing each point in \p points,
+   * optionally restricted to a set of allowed subdomains, and fills
+   * \p elements such that \p elements[i] contains \p points[i].  The
+   * queries are sorted spatially before descending the tree, so that
+   * consecutive lookups tend to hit the per-thread last-element
+   * cache instead of repeating the descent from the root.  In
+   * out-of-mesh mode entries for uncontained points are \p nullptr.
+   */
+  void locate (const std::vector<Point> & points,
+               std::vector<const Elem *> & elements,
+               const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
   /**
    * Locates a set of elements in proximity to the point with global coordinates
    * \p p  Pure virtual. Optionally allows the user to restrict the subdomains searched.
@@ -171,11 +186,27 @@ protected:
   TreeBase * _tree;
 
   /**
-   * Pointer to the last element that was found by the tree.
-   * Chances are that this may be close to the next call to
-   * \p operator()...
+   * \returns This thread's cached pointer to the last element found
+   * by this locator, or \p nullptr if the cache is cold.  Chances
+   * are that this may be close to the next call to \p operator()...
+   * Each thread owns its own slot, so concurrent queries through a
+   * shared locator never race on the cache.
+   */
+  const Elem * cached_element () const;
+
+  /**
+   * Stores \p elem in this thread's cache slot, to be tried first
+   * by the next query on this thread.
+   */
+  void set_cached_element (const Elem * elem) const;
+
+  /**
+   * Identifies the current generation of this locator's per-thread
+   * cache slots.  Generation numbers are never reused, so slots left
+   * behind by a destroyed or reinitialized locator are recognized as
+   * stale and ignored rather than dereferenced.
    */
-  mutable const Elem * _element;
+  unsigned int _cache_generation;
 
   /**
    * \p true if out-of-mesh mode is enabled.  See \p
@@ -32,6 +32,88 @@
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
+/**
+ * The P2QuantileEstimator class implements the P^2 algorithm of Jain
+ * & Chlamtac for estimating a single quantile of a data stream in one
+ * pass, using a fixed set of five markers rather than a sorted copy
+ * of the data.  It is therefore suitable for data sets too large to
+ * sort or duplicate in memory.  The estimate is exact for streams of
+ * five or fewer samples and approximate otherwise.
+ *
+ * Reference: R. Jain and I. Chlamtac, "The P^2 algorithm for dynamic
+ * calculation of quantiles and histograms without storing
+ * observations", Communications of the ACM 28(10), 1985.
+ *
+ * \author John W. Peterson
+ * \date 2020
+ * \brief One-pass, bounded-memory quantile estimation.
+ */
+class P2QuantileEstimator
+{
+public:
+
+  /**
+   * Constructor.  \p fraction is the quantile to be estimated,
+   * e.g. 0.5 for the median.
+   */
+  explicit
+  P2QuantileEstimator (Real fraction = 0.5);
+
+  /**
+   * Processes one more sample from the data stream.
+   */
+  void add_sample (Real x);
+
+  /**
+   * \returns The current estimate of the requested quantile, or zero
+   * if no samples have been processed.
+   */
+  Real estimate () const;
+
+  /**
+   * \returns The number of samples processed so far.
+   */
+  dof_id_type n_samples () const { return _n; }
+
+private:
+
+  /**
+   * The quantile being estimated.
+   */
+  Real _fraction;
+
+  /**
+   * Number of samples processed so far.
+   */
+  dof_id_type _n;
+
+  /**
+   * Marker heights.  The first five samples are stored here, sorted;
+   * thereafter _q[2] tracks the requested quantile while _q[0] and
+   * _q[4] track the stream minimum and maximum.
+   */
+  Real _q[5];
+
+  /**
+   * Actual marker positions, counted in samples from the start of the
+   * stream.
+   */
+  dof_id_type _pos[5];
+
+  /**
+   * Desired (ideal) marker positions, and the amount each grows by
+   * per sample.
+   */
+  Real _np[5];
+  Real _dn[5];
+};
+
+
 /**
  * The StatisticsVector class is derived from the std::vector<> and
  * therefore has all of its useful features.  It was designed to not
@@ -122,6 +204,18 @@ public:
    */
   virtual Real median() const;
 
+  /**
+   * \returns An estimate of the quantile \p fraction of the data set
+   * (e.g. the median for fraction = 0.5), computed in a single pass
+   * with a P2QuantileEstimator.
+   *
+   * Unlike median(), this neither sorts nor copies the data, so it
+   * can be used on data sets too large to duplicate in memory.  The
+   * result is exact for data sets with five or fewer entries and
+   * approximate otherwise.
+   */
+  virtual Real p2_quantile(const Real fraction = 0.5) const;
+
   /**
    * \returns The variance of the data set.
    *
@@ -164,6 +258,17 @@ public:
   virtual Real stddev(const Real known_mean) const
   { return std::sqrt(this->variance(known_mean)); }
 
+  /**
+   * Computes the mean and (sample) variance of the data set together,
+   * in a single pass over the data, using Welford's online
+   * recurrence.
+   *
+   * The results are identical to calling mean() and then variance(),
+   * but the data is only read once instead of three times.
+   */
+  virtual void mean_and_variance(Real & the_mean,
+                                 Real & the_variance) const;
+
   /**
    * Divides all entries by the largest entry and stores the result.
    */
@@ -184,13 +289,12 @@ public:
   /**
    * Generates a Matlab/Octave style file which can be used to
    * make a plot of the histogram having the desired number of bins.
-   * Uses the histogram(...) function in this class
-   * WARNING: The histogram(...) function is non-const, and changes
-   * the order of the vector.
+   * Uses the histogram_streaming(...) function in this class, so the
+   * data set is neither sorted nor copied.
    */
   void plot_histogram(const processor_id_type my_procid,
                       const std::string & filename,
-                      unsigned int n_bins);
+                      unsigned int n_bins) const;
 
   /**
    * A const version of the histogram function.
@@ -198,6 +302,29 @@ public:
   virtual void histogram (std::vector<dof_id_type> & bin_members,
                           unsigned int n_bins=10) const;
 
+  /**
+   * \returns The same uniform-bin histogram as histogram(), but
+   * computed by direct binning with O(n_bins) auxiliary storage,
+   * without sorting or copying the data.
+   *
+   * For data sets too large to sort or duplicate in memory this
+   * should be preferred over either version of histogram().
+   */
+  virtual void histogram_streaming (std::vector<dof_id_type> & bin_members,
+                                    unsigned int n_bins=10) const;
+
+  /**
+   * Computes a uniform-bin histogram of a data set which is
+   * distributed across the processors of \p comm, each processor
+   * holding its local portion in this vector.  The bins span the
+   * global [minimum, maximum] range, and the local bin counts are
+   * summed across processors, so every processor receives the global
+   * histogram while only O(n_bins) data crosses the network.
+   */
+  virtual void histogram_streaming (const Parallel::Communicator & comm,
+                                    std::vector<dof_id_type> & bin_members,
+                                    unsigned int n_bins=10) const;
+
   /**
    * \returns A vector of dof_id_types which corresponds
    * to the indices of every member of the data set
@@ -43,9 +43,12 @@ public:
   template <typename T1, typename T2>
   std::size_t operator()(const std::pair<T1, T2> & x) const
   {
-    // recommendation from
-    // http://stackoverflow.com/questions/5889238/why-is-xor-the-default-way-to-combine-hashes
-    return 3 * std::hash<T1>()(x.first) + std::hash<T2>()(x.second);
+    // boost::hash_combine-style mixing.  Node id pairs from refinement
+    // are dense and highly correlated, and a linear combination left
+    // them clustered in a fraction of the buckets.
+    std::size_t h = std::hash<T1>()(x.first);
+    h ^= std::hash<T2>()(x.second) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
   }
 };
 
@@ -75,6 +78,12 @@ public:
 
   void clear() { _map.clear(); }
 
+  /**
+   * Reserves space for at least \p entries additional map entries, so
+   * that a refinement step of known size can insert without rehashing.
+   */
+  void reserve(std::size_t entries) { _map.reserve(_map.size() + entries); }
+
   /**
    * Add a node to the map, between each pair of specified bracketing
    * nodes.
@@ -106,6 +106,24 @@ public:
                            const std::set<subdomain_id_type> * allowed_subdomains = nullptr,
                            Real relative_tol = TOLERANCE) const;
 
+  /**
+   * Inserts \p elem into the tree without rebuilding it.  Together
+   * with \p remove_element() this lets a tree track adaptive
+   * refinement incrementally: remove the elements that were coarsened
+   * away and insert their replacements, instead of reconstructing the
+   * tree from scratch after every mesh change.
+   *
+   * \returns \p true iff \p elem was inserted.
+   */
+  bool insert_element (const Elem * elem);
+
+  /**
+   * Removes \p elem from the tree without rebuilding it.
+   *
+   * \returns \p true iff \p elem was found and removed.
+   */
+  bool remove_element (const Elem * elem);
+
 private:
   /**
    * The tree root.
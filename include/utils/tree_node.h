@@ -95,6 +95,28 @@ public:
    */
   bool insert (const Elem * nd);
 
+  /**
+   * Bulk-loads \p candidate_elements into the TreeNode.  The
+   * candidates are binned top-down: each node keeps the candidates
+   * it bounds and either becomes a leaf directly or subdivides and
+   * hands its bin to its children, with the child subtrees of the
+   * root built concurrently.  This constructs the same tree that
+   * repeated \p insert() calls would, without the intermediate
+   * refine-and-reinsert churn.
+   *
+   * \returns \p true iff any candidate was inserted.
+   */
+  bool bulk_insert (const std::vector<const Elem *> & candidate_elements);
+
+  /**
+   * Removes \p Elem \p el from the TreeNode and from any children
+   * bounding it.  Use together with \p insert() to update the tree
+   * after adaptive refinement instead of rebuilding it from scratch.
+   *
+   * \returns \p true iff \p el was found and removed.
+   */
+  bool remove (const Elem * el);
+
   /**
    * Refine the tree node into N children if it contains
    * more than tol nodes.
@@ -190,6 +212,13 @@ private:
                                   const std::set<subdomain_id_type> * allowed_subdomains,
                                   Real relative_tol) const;
 
+  /**
+   * \returns \p true if the loose bounding box of \p el intersects
+   * our own bounding box (ignoring z-coordinates for a QuadTree),
+   * false otherwise.
+   */
+  bool bounds_elem (const Elem * el) const;
+
   /**
    * Constructs the bounding box for child \p c.
    */
@@ -72,7 +72,8 @@ public:
 
   /**
    * Constructor.  Takes the filename and the mode.
-   * Valid modes are ENCODE, DECODE, READ, and WRITE.
+   * Valid modes are ENCODE, DECODE, READ, WRITE,
+   * READ_BINARY, and WRITE_BINARY.
    */
   Xdr (const std::string & name="", const XdrMODE m=UNKNOWN);
 
@@ -110,13 +111,13 @@ public:
    * \returns \p true if the file is opened in a reading
    * state, false otherwise.
    */
-  bool reading() const { return ((mode == DECODE) || (mode == READ)); }
+  bool reading() const { return ((mode == DECODE) || (mode == READ) || (mode == READ_BINARY)); }
 
   /**
    * \returns \p true if the file is opened in a writing
    * state, false otherwise.
    */
-  bool writing() const { return ((mode == ENCODE) || (mode == WRITE)); }
+  bool writing() const { return ((mode == ENCODE) || (mode == WRITE) || (mode == WRITE_BINARY)); }
 
   /**
    * \returns The mode used to access the file.  Valid modes
@@ -197,6 +198,33 @@ private:
   template <typename T>
   void do_write(std::vector<std::complex<T>> & a);
 
+  /**
+   * Helper methods for the raw binary modes.  \p raw_write appends \p
+   * n_bytes from \p buf to the output stream; \p raw_read copies the
+   * next \p n_bytes out of the memory-mapped input file (or out of
+   * the fallback read buffer) and advances the read position.
+   */
+  void raw_write (const void * buf, std::size_t n_bytes);
+  void raw_read (void * buf, std::size_t n_bytes);
+
+  /**
+   * Helper methods for reading/writing whole values in the raw binary
+   * format: scalars are stored as their in-memory representation,
+   * vectors and strings as a 64-bit length followed by the contiguous
+   * data.
+   */
+  template <typename T>
+  void do_raw_read(T & a);
+
+  template <typename T>
+  void do_raw_read(std::vector<T> & a);
+
+  template <typename T>
+  void do_raw_write(T & a);
+
+  template <typename T>
+  void do_raw_write(std::vector<T> & a);
+
   /**
    * The mode used for accessing the file.
    */
@@ -243,6 +271,27 @@ private:
    */
   bool gzipped_file, bzipped_file, xzipped_file;
 
+  /**
+   * Base, extent, and current read position of the input file in \p
+   * READ_BINARY mode.  The base points either at an mmap'ed region of
+   * the file or, if mapping it failed, at \p _raw_buffer.
+   */
+  const char * _raw_base;
+  std::size_t _raw_size;
+  std::size_t _raw_cursor;
+
+  /**
+   * Whether \p _raw_base came from \p mmap and so must be unmapped on
+   * close.
+   */
+  bool _raw_mapped;
+
+  /**
+   * Fallback storage for \p READ_BINARY when the file cannot be
+   * mapped.
+   */
+  std::vector<char> _raw_buffer;
+
   /**
    * Version of the file being read
    */
@@ -340,6 +340,31 @@ AS_IF([test "$enableuniqueid" = yes],
 
 
 
+# -------------------------------------------------------------
+# compact DofObject headers -- disabled by default
+#
+# Moves the AMR-only old_dof_object pointer out of every DofObject
+# and into a side table, recovering sizeof(DofObject*) bytes per
+# node and element for memory-constrained runs.
+# -------------------------------------------------------------
+AC_ARG_ENABLE(compact-dof-objects,
+              AS_HELP_STRING([--enable-compact-dof-objects],
+                             [shrink DofObject headers by keeping old dof indexing in a side table]),
+              [AS_CASE("${enableval}",
+                       [yes], [enablecompactdofobjects=yes],
+                       [no],  [enablecompactdofobjects=no],
+                       [AC_MSG_ERROR(bad value ${enableval} for --enable-compact-dof-objects)])],
+              [enablecompactdofobjects=no])
+
+AS_IF([test "$enablecompactdofobjects" = yes],
+      [
+        AC_DEFINE(ENABLE_COMPACT_DOF_OBJECTS, 1, [Flag indicating if the library should shrink DofObject headers by keeping old dof indexing in a side table])
+        AC_MSG_RESULT(<<< Configuring library with compact DofObject headers >>>)
+      ])
+# -------------------------------------------------------------
+
+
+
 # --------------------------------------------------------------
 # Write stack trace output files on error() - disabled by default
 # --------------------------------------------------------------
@@ -544,6 +569,24 @@ AS_IF([test "$enablepfem" != no],
 
 
 
+# -------------------------------------------------------------
+# exotic FE families -- enabled by default
+# -------------------------------------------------------------
+AC_ARG_ENABLE(exotic-fe-families,
+              AS_HELP_STRING([--disable-exotic-fe-families],
+                             [build without the rarely-used CLOUGH, HERMITE, HIERARCHIC, L2_HIERARCHIC and XYZ FE families, shrinking the library]),
+              enableexoticfe=$enableval,
+              enableexoticfe=yes)
+
+AS_IF([test "$enableexoticfe" != no],
+      [
+        AC_DEFINE(ENABLE_EXOTIC_FE_FAMILIES, 1, [Flag indicating if the library should offer the less commonly used FE families])
+        AC_MSG_RESULT(<<< Configuring library with exotic FE families >>>)
+      ])
+# -------------------------------------------------------------
+
+
+
 # -------------------------------------------------------------
 # Infinite Elements  -- disabled by default
 # -------------------------------------------------------------
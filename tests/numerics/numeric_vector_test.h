@@ -17,7 +17,9 @@
   CPPUNIT_TEST( testLocalizeIndices );          \
   CPPUNIT_TEST( testLocalizeIndicesBase );      \
   CPPUNIT_TEST( testLocalizeToOne );            \
-  CPPUNIT_TEST( testLocalizeToOneBase );
+  CPPUNIT_TEST( testLocalizeToOneBase );        \
+  CPPUNIT_TEST( testStagedAdds );                \
+  CPPUNIT_TEST( testFusedOps );
 
 #ifndef LIBMESH_HAVE_CXX14_MAKE_UNIQUE
 using libMesh::make_unique;
@@ -164,6 +166,112 @@ public:
   {
     LocalizeIndices<libMesh::NumericVector<libMesh::Number>,DerivedClass>();
   }
+
+  void testStagedAdds()
+  {
+    unsigned int block_size  = 10;
+
+    // a different size on each processor.
+    unsigned int local_size  = block_size +
+      static_cast<unsigned int>(my_comm->rank());
+    unsigned int global_size = 0;
+
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    {
+      auto v_ptr = libmesh_make_unique<DerivedClass>(*my_comm, global_size, local_size);
+      libMesh::NumericVector<libMesh::Number> & v = *v_ptr;
+
+      const libMesh::dof_id_type
+        first = v.first_local_index(),
+        last  = v.last_local_index();
+
+      // Stage unsorted, overlapping contributions: each local index
+      // gets 1 from one batch and its index value from another.
+      std::vector<libMesh::dof_id_type> indices;
+      std::vector<libMesh::Number> values;
+      for (libMesh::dof_id_type n=last; n != first; n--)
+        {
+          indices.push_back(n-1);
+          values.push_back(1);
+        }
+      v.stage_add_vector (values.data(), indices);
+
+      for (std::size_t i=0; i != values.size(); i++)
+        values[i] = static_cast<libMesh::Number>(indices[i]);
+      v.stage_add_vector (values.data(), indices);
+
+      // Nothing is applied until we flush.
+      v.flush_staged_adds();
+      v.close();
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(n+1),
+                                libMesh::libmesh_real(v(n)),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+    }
+  }
+
+  void testFusedOps()
+  {
+    unsigned int block_size  = 10;
+
+    // a different size on each processor.
+    unsigned int local_size  = block_size +
+      static_cast<unsigned int>(my_comm->rank());
+    unsigned int global_size = 0;
+
+    for (libMesh::processor_id_type p=0; p<my_comm->size(); p++)
+      global_size += (block_size + static_cast<unsigned int>(p));
+
+    {
+      auto u_ptr = libmesh_make_unique<DerivedClass>(*my_comm, global_size, local_size);
+      auto x_ptr = libmesh_make_unique<DerivedClass>(*my_comm, global_size, local_size);
+      auto y_ptr = libmesh_make_unique<DerivedClass>(*my_comm, global_size, local_size);
+      libMesh::NumericVector<libMesh::Number> & u = *u_ptr;
+      libMesh::NumericVector<libMesh::Number> & x = *x_ptr;
+      libMesh::NumericVector<libMesh::Number> & y = *y_ptr;
+
+      const libMesh::dof_id_type
+        first = u.first_local_index(),
+        last  = u.last_local_index();
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        {
+          u.set (n, 1);
+          x.set (n, static_cast<libMesh::Number>(n));
+          y.set (n, 2);
+        }
+      u.close();
+      x.close();
+      y.close();
+
+      const std::vector<libMesh::Number> a = {3, -1};
+      const std::vector<const libMesh::NumericVector<libMesh::Number> *>
+        terms = {&x, &y};
+
+      // u += 3*x - y, in one fused pass.
+      u.add_vectors (a, terms);
+
+      for (libMesh::dof_id_type n=first; n != last; n++)
+        LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(3.*n-1.),
+                                libMesh::libmesh_real(u(n)),
+                                libMesh::TOLERANCE*libMesh::TOLERANCE);
+
+      // Batched dots should match one-at-a-time dots.
+      std::vector<libMesh::Number> fused_dots;
+      u.dot_vectors (terms, fused_dots);
+
+      CPPUNIT_ASSERT_EQUAL (std::size_t(2), fused_dots.size());
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u.dot(x)),
+                              libMesh::libmesh_real(fused_dots[0]),
+                              libMesh::TOLERANCE);
+      LIBMESH_ASSERT_FP_EQUAL(libMesh::libmesh_real(u.dot(y)),
+                              libMesh::libmesh_real(fused_dots[1]),
+                              libMesh::TOLERANCE);
+    }
+  }
 };
 
 #endif // #ifdef __numeric_vector_test_h__